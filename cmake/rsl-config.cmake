@@ -4,6 +4,7 @@ find_dependency(Eigen3 CONFIG)
 find_dependency(fmt)
 find_dependency(rclcpp)
 find_dependency(tcb_span)
+find_dependency(Threads)
 find_dependency(tl-expected)
 
 include(${CMAKE_CURRENT_LIST_DIR}/rsl-targets.cmake)
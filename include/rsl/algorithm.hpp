@@ -1,11 +1,339 @@
 #pragma once
 
+#include <rsl/static_vector.hpp>
+
+#include <tcb_span/span.hpp>
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace rsl {
 
 /** @file */
 
+/**
+ * @brief Largest StaticVector capacity for which rsl::sort uses a sorting network instead of
+ * std::sort
+ */
+constexpr inline size_t sorting_network_max_capacity = 64;
+
+/**
+ * @brief Execution policy for running RSL algorithms on several threads. Example usage:
+ *
+ * @code
+ * rsl::contains(rsl::parallel, calibration_table, value);
+ * rsl::is_unique(rsl::ParallelPolicy{4}, point_ids); // At most 4 threads
+ * @endcode
+ *
+ * The input is split into one contiguous chunk per thread, and the calling thread works on the
+ * first chunk. Threads stop early once any of them finds a match or violation that decides the
+ * result. Each call starts its own threads, which costs tens of microseconds, so inputs with fewer
+ * than 2 * min_chunk_size elements run serially on the calling thread.
+ *
+ * Comparisons, hashes and validator predicates must not throw when more than one thread is used:
+ * an exception on a worker thread calls std::terminate. Exceptions on the calling thread, or when
+ * the input runs serially, propagate to the caller after all worker threads have been joined.
+ */
+struct ParallelPolicy {
+    /**
+     * @brief Number of threads to use, or zero for std::thread::hardware_concurrency()
+     */
+    size_t thread_count = 0;
+
+    /**
+     * @brief Smallest number of elements given to a thread
+     */
+    size_t min_chunk_size = size_t(1) << 16;
+};
+
+/**
+ * @brief Default parallel execution policy
+ */
+constexpr inline auto parallel = ParallelPolicy();
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+[[nodiscard]] constexpr auto next_power_of_two(size_t n) {
+    auto power = size_t(1);
+    while (power < n) power *= 2;
+    return power;
+}
+
+struct Comparator {
+    uint8_t lower;
+    uint8_t upper;
+};
+
+// Batcher's odd-even merge sort. Every comparator puts the smaller element at the lower index, so
+// dropping the comparators that touch an index at or past the size sorts the leading elements.
+// Writes the comparators to network if it is not null and returns how many there are.
+constexpr auto batcher_network(size_t n, Comparator* network) {
+    auto count = size_t(0);
+    for (size_t p = 1; p < n; p *= 2) {
+        for (size_t k = p; k >= 1; k /= 2) {
+            for (size_t j = k % p; j + k < n; j += 2 * k) {
+                for (size_t i = 0; i < std::min(k, n - j - k); ++i) {
+                    if ((i + j) / (2 * p) != (i + j + k) / (2 * p)) continue;
+                    if (network != nullptr)
+                        network[count] = Comparator{uint8_t(i + j), uint8_t(i + j + k)};
+                    ++count;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+template <size_t n>
+[[nodiscard]] constexpr auto sorting_network() {
+    auto network = std::array<Comparator, batcher_network(n, nullptr)>();
+    batcher_network(n, network.data());
+    return network;
+}
+
+template <size_t n>
+constexpr inline auto sorting_network_v = sorting_network<n>();
+
+template <typename T, typename Compare>
+constexpr void compare_exchange(T& lower, T& upper, Compare& compare) {
+    if constexpr (std::is_arithmetic_v<T> && std::is_same_v<Compare, std::less<>>) {
+        // Compiles to min/max instructions rather than a branch
+        auto const a = lower;
+        auto const b = upper;
+        lower = std::min(a, b);
+        upper = std::max(a, b);
+    } else {
+        if (compare(upper, lower)) std::swap(lower, upper);
+    }
+}
+
+template <size_t n, typename T, typename Compare, size_t... indices>
+constexpr void apply_network(std::array<T, n>& data, Compare& compare,
+                             std::index_sequence<indices...> /*unused*/) {
+    constexpr auto const& network = sorting_network_v<n>;
+    (compare_exchange(data[network[indices].lower], data[network[indices].upper], compare), ...);
+}
+
+template <size_t capacity, typename T, typename Compare>
+void network_sort(T* data, size_t size, Compare& compare) {
+    constexpr auto n = next_power_of_two(capacity);
+    static_assert(n <= 256, "Sorting network indices must fit in uint8_t");
+    constexpr auto count = sorting_network_v<n>.size();
+    if constexpr (std::is_arithmetic_v<T> && std::is_same_v<Compare, std::less<>>) {
+        // Pad with the largest value so the fully unrolled network runs without branches
+        auto buffer = std::array<T, n>();
+        std::copy_n(data, size, buffer.begin());
+        std::fill(buffer.begin() + std::ptrdiff_t(size), buffer.end(),
+                  std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                       : std::numeric_limits<T>::max());
+        apply_network(buffer, compare, std::make_index_sequence<count>());
+        std::copy_n(buffer.cbegin(), size, data);
+    } else {
+        for (auto const [lower, upper] : sorting_network_v<n>)
+            if (upper < size) compare_exchange(data[lower], data[upper], compare);
+    }
+}
+
+// Number of chunks to split size elements into, at most one per thread
+[[nodiscard]] inline auto chunk_count(ParallelPolicy const& policy, size_t size) -> size_t {
+    auto const threads = policy.thread_count != 0
+                             ? policy.thread_count
+                             : std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+    return std::max(std::min(threads, size / std::max(policy.min_chunk_size, size_t(1))),
+                    size_t(1));
+}
+
+// Runs work(chunk, begin, end) for each chunk, one thread per chunk after the first
+template <typename Work>
+void run_chunks(size_t chunks, size_t size, Work const& work) {
+    auto threads = std::vector<std::thread>();
+    auto const join = [&threads] {
+        for (auto& thread : threads) thread.join();
+    };
+    // Joinable threads must not be destroyed, so join before rethrowing if starting a thread or
+    // the calling thread's chunk throws
+    try {
+        threads.reserve(chunks - 1);
+        for (size_t chunk = 1; chunk < chunks; ++chunk) {
+            threads.emplace_back(work, chunk, chunk * size / chunks, (chunk + 1) * size / chunks);
+        }
+        work(size_t(0), size_t(0), size / chunks);
+    } catch (...) {
+        join();
+        throw;
+    }
+    join();
+}
+
+// Lowest index in [0, size) for which find_in_block(begin, end) reports a match, or size if there
+// is none. find_in_block returns the index of the first match in [begin, end), or end. Each chunk
+// is searched in blocks and stops once a match has been found before its next block.
+template <typename FindInBlock>
+[[nodiscard]] auto parallel_find_first(ParallelPolicy const& policy, size_t size,
+                                       FindInBlock const& find_in_block) -> size_t {
+    constexpr auto block_size = size_t(4096);
+    auto const chunks = chunk_count(policy, size);
+    if (chunks == 1) return find_in_block(size_t(0), size);
+
+    auto first = std::atomic<size_t>(size);
+    run_chunks(chunks, size, [&](size_t /*chunk*/, size_t begin, size_t end) {
+        for (; begin < end && begin < first.load(std::memory_order_relaxed); begin += block_size) {
+            auto const block_end = std::min(begin + block_size, end);
+            auto const found = find_in_block(begin, block_end);
+            if (found == block_end) continue;
+            auto current = first.load(std::memory_order_relaxed);
+            while (found < current && !first.compare_exchange_weak(current, found)) {
+            }
+            return;
+        }
+    });
+    return first.load();
+}
+
+template <typename T, typename = void>
+constexpr bool is_hashable_v = false;
+
+template <typename T>
+constexpr bool is_hashable_v<T, std::void_t<decltype(std::hash<T>()(std::declval<T const&>()))>> =
+    true;
+
+template <typename T, typename = void>
+constexpr bool is_less_than_comparable_v = false;
+
+template <typename T>
+constexpr bool is_less_than_comparable_v<
+    T, std::void_t<decltype(std::declval<T const&>() < std::declval<T const&>())>> = true;
+
+// Open addressing table of pointers to the elements, with linear probing and at most half full,
+// so there is one allocation rather than one per node. Hashes are multiplied by a constant and the
+// high bits used because std::hash is the identity for integers in common implementations.
+template <typename T, typename Iterator>
+[[nodiscard]] auto is_unique_hashed(Iterator first, Iterator last, size_t size) {
+    auto bits = 1;
+    while ((size_t(1) << bits) < 2 * size) ++bits;
+    auto const capacity = size_t(1) << bits;
+    auto slots = std::vector<T const*>(capacity, nullptr);
+    for (; first != last; ++first) {
+        auto const* const element = std::addressof(*first);
+        auto const hash = uint64_t(std::hash<T>()(*element));
+        auto slot = size_t((hash * 0x9e3779b97f4a7c15) >> (64 - bits));
+        for (; slots[slot] != nullptr; slot = (slot + 1) & (capacity - 1)) {
+            if (*slots[slot] == *element) return false;
+        }
+        slots[slot] = element;
+    }
+    return true;
+}
+
+// As is_unique_hashed, with threads inserting into a shared table by compare and swap. Equal
+// elements probe the same slots, so whichever thread loses the race for a slot sees the other
+// element there.
+template <typename T>
+[[nodiscard]] auto parallel_is_unique_hashed(ParallelPolicy const& policy,
+                                             tcb::span<T const* const> elements) -> bool {
+    auto bits = 1;
+    while ((size_t(1) << bits) < 2 * elements.size()) ++bits;
+    auto const capacity = size_t(1) << bits;
+    auto slots = std::vector<std::atomic<T const*>>(capacity);
+    auto duplicate = std::atomic<bool>(false);
+    auto const insert = [&](size_t /*chunk*/, size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            if (i % 1024 == 0 && duplicate.load(std::memory_order_relaxed)) return;
+            auto const* const element = elements[i];
+            auto const hash = uint64_t(std::hash<T>()(*element));
+            auto slot = size_t((hash * 0x9e3779b97f4a7c15) >> (64 - bits));
+            for (;; slot = (slot + 1) & (capacity - 1)) {
+                auto const* expected = static_cast<T const*>(nullptr);
+                if (slots[slot].compare_exchange_strong(expected, element)) break;
+                if (*expected == *element) {
+                    duplicate.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+    };
+    run_chunks(chunk_count(policy, elements.size()), elements.size(), insert);
+    return !duplicate.load();
+}
+
+template <typename Collection, typename Value, typename = void>
+constexpr bool has_member_contains_v = false;
+
+template <typename Collection, typename Value>
+constexpr bool has_member_contains_v<
+    Collection, Value,
+    std::void_t<decltype(std::declval<Collection const&>().contains(std::declval<Value>()))>> =
+    true;
+
+// Excludes member functions like std::string::find that return a position rather than an iterator
+template <typename Collection, typename Value, typename = void>
+constexpr bool has_member_find_v = false;
+
+template <typename Collection, typename Value>
+constexpr bool has_member_find_v<
+    Collection, Value,
+    std::void_t<decltype(std::declval<Collection const&>().find(std::declval<Value>()) !=
+                         std::declval<Collection const&>().end())>> = true;
+
+template <typename Collection>
+using element_t =
+    std::remove_cv_t<std::remove_reference_t<decltype(*std::cbegin(std::declval<Collection&>()))>>;
+
+template <typename Collection>
+constexpr bool is_contiguous_v =
+    std::is_convertible_v<Collection const&, tcb::span<element_t<Collection> const>>;
+
+template <typename Collection, typename Value>
+constexpr bool is_contiguous_arithmetic_v =
+    is_contiguous_v<Collection> && std::is_arithmetic_v<element_t<Collection>> &&
+    std::is_same_v<element_t<Collection>, std::remove_cv_t<Value>>;
+
+// Compares a block of elements at a time and ORs the results, which compilers turn into SIMD
+// compares and a mask test per block rather than a branch per element
+template <typename T>
+[[nodiscard]] auto contains_scan(tcb::span<T const> values, T value) {
+    constexpr auto lanes = 64 / sizeof(T);
+    auto i = size_t(0);
+    for (; i + lanes <= values.size(); i += lanes) {
+        auto matches = 0U;
+        for (size_t lane = 0; lane < lanes; ++lane) matches |= unsigned(values[i + lane] == value);
+        if (matches != 0) return true;
+    }
+    for (; i < values.size(); ++i)
+        if (values[i] == value) return true;
+    return false;
+}
+
+// Binary search whose only branch is the loop, as the comparison result selects the next base
+template <typename T, typename Value, typename Compare>
+[[nodiscard]] auto sorted_contains(tcb::span<T const> values, Value const& value,
+                                   Compare& compare) {
+    if (values.empty()) return false;
+    auto const* base = values.data();
+    for (auto size = values.size(); size > 1; size -= size / 2) {
+        base = compare(base[size / 2 - 1], value) ? base + size / 2 : base;
+    }
+    if (compare(*base, value)) ++base;
+    return base != values.data() + values.size() && !compare(value, *base);
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
 /**
  * @brief Determine if a collection contains a value. Example usage:
  *
@@ -13,12 +341,140 @@ namespace rsl {
  * auto values = std::vector{1, 2, 3};
  * rsl::contains(values, 3); // true
  * rsl::contains(values, -1); // false
+ * rsl::contains(std::map<std::string, int>{{"a", 1}}, "a"); // true, looks up the key
  * @endcode
+ *
+ * Uses the collection's member contains or find when it has one, so sets and maps are searched in
+ * logarithmic or constant time. Contiguous collections of arithmetic types are scanned several
+ * elements at a time with SIMD compares. Anything else uses std::find.
  */
-template <typename Collection>
-[[nodiscard]] auto contains(Collection const& collection,
-                            typename Collection::const_reference value) {
-    return std::find(collection.cbegin(), collection.cend(), value) != collection.cend();
+template <typename Collection, typename Value = typename Collection::value_type>
+[[nodiscard]] auto contains(Collection const& collection, Value const& value) -> bool {
+    if constexpr (detail::has_member_contains_v<Collection, Value const&>) {
+        return collection.contains(value);
+    } else if constexpr (detail::has_member_find_v<Collection, Value const&>) {
+        return collection.find(value) != collection.end();
+    } else if constexpr (detail::is_contiguous_arithmetic_v<Collection, Value>) {
+        using T = detail::element_t<Collection>;
+        return detail::contains_scan(tcb::span<T const>(collection), value);
+    } else {
+        return std::find(std::cbegin(collection), std::cend(collection), value) !=
+               std::cend(collection);
+    }
+}
+
+/**
+ * @brief Determine if a collection contains a value, searching on several threads
+ *
+ * Contiguous collections are split across threads, which return as soon as any of them finds the
+ * value. Other collections, and contiguous ones with fewer than 2 * policy.min_chunk_size
+ * elements, use the serial rsl::contains.
+ */
+template <typename Collection, typename Value = typename Collection::value_type>
+[[nodiscard]] auto contains(ParallelPolicy const& policy, Collection const& collection,
+                            Value const& value) -> bool {
+    if constexpr (!detail::has_member_contains_v<Collection, Value const&> &&
+                  !detail::has_member_find_v<Collection, Value const&> &&
+                  detail::is_contiguous_v<Collection>) {
+        using T = detail::element_t<Collection>;
+        auto const span = tcb::span<T const>(collection);
+        auto const find_in_block = [&span, &value](size_t begin, size_t end) {
+            auto const block = span.subspan(begin, end - begin);
+            if constexpr (detail::is_contiguous_arithmetic_v<Collection, Value>) {
+                return detail::contains_scan(block, value) ? begin : end;  // Any index will do
+            } else {
+                return begin + size_t(std::find(block.begin(), block.end(), value) - block.begin());
+            }
+        };
+        return detail::parallel_find_first(policy, span.size(), find_in_block) != span.size();
+    } else {
+        return contains(collection, value);
+    }
+}
+
+/**
+ * @brief Determine if a sorted collection contains a value. Example usage:
+ *
+ * @code
+ * auto const sorted_ids = std::vector{2, 3, 5, 7, 11};
+ * rsl::contains_sorted(sorted_ids, 7); // true
+ * @endcode
+ *
+ * Binary search in O(log n). Contiguous collections use a branchless search, whose memory accesses
+ * do not depend on mispredicted branches. The result is unspecified if the collection is not sorted
+ * by compare.
+ *
+ * @param collection Collection sorted by compare
+ * @param value Value to search for
+ * @param compare Strict weak ordering the collection is sorted by
+ */
+template <typename Collection, typename Value = typename Collection::value_type,
+          typename Compare = std::less<>>
+[[nodiscard]] auto contains_sorted(Collection const& collection, Value const& value,
+                                   Compare compare = Compare()) -> bool {
+    if constexpr (detail::is_contiguous_v<Collection>) {
+        using T = detail::element_t<Collection>;
+        return detail::sorted_contains(tcb::span<T const>(collection), value, compare);
+    } else {
+        return std::binary_search(std::cbegin(collection), std::cend(collection), value, compare);
+    }
+}
+
+/**
+ * @brief Largest size for which rsl::is_unique compares every pair of elements instead of hashing
+ * or sorting
+ */
+constexpr inline size_t is_unique_quadratic_max_size = 32;
+
+/**
+ * @brief Determine if all elements in a range are unique. Example usage:
+ *
+ * @code
+ * auto const values = std::vector{1, 2, 3};
+ * rsl::is_unique(values.cbegin(), values.cend()); // true
+ * @endcode
+ *
+ * Neither copies nor modifies the elements, so they need not be copyable. Ranges of up to
+ * rsl::is_unique_quadratic_max_size elements compare every pair with operator==, which needs no
+ * allocation. Larger ranges insert pointers to the elements into a flat hash table if std::hash
+ * supports them, for O(n) expected time, or otherwise sort pointers to the elements with operator<.
+ * Elements that support neither are compared pairwise at any size.
+ */
+template <typename Iterator>
+[[nodiscard]] auto is_unique(Iterator first, Iterator last) -> bool {
+    using Reference = typename std::iterator_traits<Iterator>::reference;
+    using T = std::remove_cv_t<std::remove_reference_t<Reference>>;
+    static_assert(std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<Iterator>::iterator_category>,
+                  "Iterator must be a forward iterator");
+    auto const size = size_t(std::distance(first, last));
+
+    if constexpr (std::is_lvalue_reference_v<Reference>) {
+        if constexpr (detail::is_hashable_v<T>) {
+            if (size > is_unique_quadratic_max_size) {
+                return detail::is_unique_hashed<T>(first, last, size);
+            }
+        } else if constexpr (detail::is_less_than_comparable_v<T>) {
+            if (size > is_unique_quadratic_max_size) {
+                auto pointers = std::vector<T const*>();
+                pointers.reserve(size);
+                for (; first != last; ++first) pointers.push_back(std::addressof(*first));
+                std::sort(pointers.begin(), pointers.end(),
+                          [](T const* lhs, T const* rhs) { return *lhs < *rhs; });
+                return std::adjacent_find(pointers.cbegin(), pointers.cend(),
+                                          [](T const* lhs, T const* rhs) {
+                                              return *lhs == *rhs;
+                                          }) == pointers.cend();
+            }
+        }
+    }
+
+    for (; first != last; ++first) {
+        for (auto other = std::next(first); other != last; ++other) {
+            if (*first == *other) return false;
+        }
+    }
+    return true;
 }
 
 /**
@@ -29,14 +485,148 @@ template <typename Collection>
  * rsl::is_unique(std::vector{1,2,3}); // true
  * @endcode
  *
- * Because of how this function is implemented, the collection parameter is
- * taken by value, creating a copy. The implication of this is that it will not work
- * on collections of non-copy-able objects.
+ * Takes the collection by reference and works on anything with begin and end, including spans.
+ * @see rsl::is_unique(Iterator, Iterator)
+ */
+template <typename Collection>
+[[nodiscard]] auto is_unique(Collection const& collection) -> bool {
+    return is_unique(std::cbegin(collection), std::cend(collection));
+}
+
+/**
+ * @brief Determine if all elements in a collection are unique, hashing on several threads
+ *
+ * Threads insert pointers to their elements into one shared hash table and all stop once any of
+ * them finds a duplicate. Collections of elements without std::hash, and those with fewer than
+ * 2 * policy.min_chunk_size elements, use the serial rsl::is_unique.
  */
 template <typename Collection>
-[[nodiscard]] auto is_unique(Collection collection) {
-    std::sort(collection.begin(), collection.end());
-    return std::adjacent_find(collection.cbegin(), collection.cend()) == collection.cend();
+[[nodiscard]] auto is_unique(ParallelPolicy const& policy, Collection const& collection) -> bool {
+    using Reference = decltype(*std::cbegin(collection));
+    using T = detail::element_t<Collection>;
+    if constexpr (std::is_lvalue_reference_v<Reference> && detail::is_hashable_v<T>) {
+        auto const size = size_t(std::distance(std::cbegin(collection), std::cend(collection)));
+        if (detail::chunk_count(policy, size) > 1) {
+            auto elements = std::vector<T const*>();
+            elements.reserve(size);
+            for (auto const& element : collection) elements.push_back(std::addressof(element));
+            return detail::parallel_is_unique_hashed(policy, tcb::span<T const* const>(elements));
+        }
+    }
+    return is_unique(collection);
+}
+
+/**
+ * @brief Determine if all elements in a sorted range are unique
+ *
+ * A single pass comparing neighbors, without allocating. The result is unspecified if the range is
+ * not sorted by compare.
+ *
+ * @param first Beginning of the range
+ * @param last End of the range
+ * @param compare Strict weak ordering the range is sorted by
+ */
+template <typename Iterator, typename Compare = std::less<>>
+[[nodiscard]] auto is_unique_sorted(Iterator first, Iterator last, Compare compare = Compare())
+    -> bool {
+    auto const equivalent = [&compare](auto const& lhs, auto const& rhs) {
+        return !compare(lhs, rhs);
+    };
+    return std::adjacent_find(first, last, equivalent) == last;
+}
+
+/**
+ * @brief Determine if all elements in a sorted collection are unique. Example usage:
+ *
+ * @code
+ * rsl::is_unique_sorted(std::vector{1, 2, 2, 3}); // false
+ * @endcode
+ *
+ * @see rsl::is_unique_sorted(Iterator, Iterator, Compare)
+ */
+template <typename Collection, typename Compare = std::less<>>
+[[nodiscard]] auto is_unique_sorted(Collection const& collection, Compare compare = Compare())
+    -> bool {
+    return is_unique_sorted(std::cbegin(collection), std::cend(collection), compare);
+}
+
+/**
+ * @brief Sort a StaticVector. Example usage:
+ *
+ * @code
+ * auto values = rsl::StaticVector<int, 8>{3, 1, 2};
+ * rsl::sort(values); // {1, 2, 3}
+ * @endcode
+ *
+ * For capacities up to rsl::sorting_network_max_capacity this runs a sorting network generated at
+ * compile time, which for arithmetic types and std::less<> is free of data-dependent branches.
+ * Larger capacities use std::sort. The sort is not stable.
+ */
+template <typename T, size_t capacity, typename Compare = std::less<>>
+void sort(StaticVector<T, capacity>& static_vector, Compare compare = Compare()) {
+    if constexpr (capacity <= sorting_network_max_capacity) {
+        auto const span = tcb::span<T>(static_vector);
+        detail::network_sort<capacity>(span.data(), span.size(), compare);
+    } else {
+        std::sort(static_vector.begin(), static_vector.end(), compare);
+    }
+}
+
+/**
+ * @brief Partially sort a StaticVector so the nth element is the one that would be there if it
+ * were sorted, with no greater elements before it and no smaller elements after it
+ *
+ * Uses rsl::sort for capacities up to rsl::sorting_network_max_capacity and std::nth_element
+ * otherwise.
+ */
+template <typename T, size_t capacity, typename Compare = std::less<>>
+void nth_element(StaticVector<T, capacity>& static_vector, size_t n,
+                 Compare compare = Compare()) {
+    assert(n < static_vector.size() && "rsl::nth_element: Index out of range");
+    if constexpr (capacity <= sorting_network_max_capacity) {
+        rsl::sort(static_vector, compare);
+    } else {
+        std::nth_element(static_vector.begin(),
+                         static_vector.begin() + std::ptrdiff_t(n), static_vector.end(),
+                         compare);
+    }
+}
+
+/**
+ * @brief Get the smallest and largest elements of a non-empty StaticVector
+ *
+ * For arithmetic types the scan keeps independent accumulators so the compiler can use SIMD
+ * min/max instructions.
+ *
+ * @return Pair of the minimum and maximum
+ */
+template <typename T, size_t capacity>
+[[nodiscard]] auto min_max(StaticVector<T, capacity> const& static_vector) -> std::pair<T, T> {
+    assert(!static_vector.empty() && "rsl::min_max: StaticVector must not be empty");
+    auto const span = tcb::span<T const>(static_vector);
+    if constexpr (std::is_arithmetic_v<T>) {
+        constexpr auto lanes = size_t(4);
+        auto minimums = std::array<T, lanes>();
+        auto maximums = std::array<T, lanes>();
+        minimums.fill(span[0]);
+        maximums.fill(span[0]);
+        auto i = size_t(0);
+        for (; i + lanes <= span.size(); i += lanes) {
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                minimums[lane] = std::min(minimums[lane], span[i + lane]);
+                maximums[lane] = std::max(maximums[lane], span[i + lane]);
+            }
+        }
+        for (; i < span.size(); ++i) {
+            minimums[0] = std::min(minimums[0], span[i]);
+            maximums[0] = std::max(maximums[0], span[i]);
+        }
+        return {*std::min_element(minimums.cbegin(), minimums.cend()),
+                *std::max_element(maximums.cbegin(), maximums.cend())};
+    } else {
+        auto const [min, max] = std::minmax_element(span.begin(), span.end());
+        return {*min, *max};
+    }
 }
 
 }  // namespace rsl
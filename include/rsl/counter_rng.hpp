@@ -0,0 +1,228 @@
+#pragma once
+
+#include <rsl/random.hpp>
+
+#include <tcb_span/span.hpp>
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+// Philox4x32-10 applied to several counters at once. Each word is stored as an array over lanes so
+// the rounds are plain loops over lanes that compilers vectorize.
+template <size_t lanes>
+struct PhiloxLanes {
+    std::array<std::array<uint32_t, lanes>, 4> words{};
+};
+
+template <size_t lanes>
+[[nodiscard]] constexpr auto philox4x32_10(PhiloxLanes<lanes> counters, std::array<uint32_t, 2> key)
+    -> PhiloxLanes<lanes> {
+    constexpr auto multiplier0 = uint64_t(0xd2511f53);
+    constexpr auto multiplier1 = uint64_t(0xcd9e8d57);
+
+    // Local copies let the compiler keep the lanes in registers across rounds
+    auto [c0, c1, c2, c3] = counters.words;
+    for (int round = 0; round < 10; ++round) {
+        for (size_t i = 0; i < lanes; ++i) {
+            auto const product0 = multiplier0 * c0[i];
+            auto const product1 = multiplier1 * c2[i];
+            c0[i] = uint32_t(product1 >> 32) ^ c1[i] ^ key[0];
+            c1[i] = uint32_t(product1);
+            c2[i] = uint32_t(product0 >> 32) ^ c3[i] ^ key[1];
+            c3[i] = uint32_t(product0);
+        }
+        key[0] += 0x9e3779b9;
+        key[1] += 0xbb67ae85;
+    }
+    return {{c0, c1, c2, c3}};
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Counter-based random number generator, where every random value is a pure function of
+ * the seed, the stream and the value's index. Example usage:
+ *
+ * @code
+ * auto const rng = rsl::CounterRng(seed);
+ * // Any thread can compute any sample, in any order, and get the same result
+ * auto const x = rng.uniform_real(sample_index, -1., 1.);
+ * auto const orientation = rng.random_unit_quaternion(sample_index);
+ * @endcode
+ *
+ * Implements Philox4x32-10 from "Parallel Random Numbers: As Easy as 1, 2, 3", Salmon et al.,
+ * 2011. Each index is encrypted as the counter (index, stream) with the seed as key, giving 128
+ * random bits per index. There is no mutable state, so a CounterRng can be shared between threads
+ * freely.
+ *
+ * Different methods called with the same index read the same bits and are therefore correlated.
+ * Use a different stream, or disjoint indices, for each independent quantity.
+ */
+class CounterRng {
+    std::array<uint32_t, 2> key_;
+    std::array<uint32_t, 2> stream_;
+
+   public:
+    /**
+     * @brief Construct a generator
+     * @param seed Key shared by all indices
+     * @param stream Selects an independent sequence for the same seed
+     */
+    constexpr explicit CounterRng(uint64_t seed, uint64_t stream = 0)
+        : key_{uint32_t(seed), uint32_t(seed >> 32)},
+          stream_{uint32_t(stream), uint32_t(stream >> 32)} {}
+
+    /**
+     * @brief Get the 128 random bits for an index
+     * @param index Index of the block
+     * @return Four 32 bit words
+     */
+    [[nodiscard]] constexpr auto block(uint64_t index) const -> std::array<uint32_t, 4> {
+        auto const counters = detail::philox4x32_10(counter_lanes<1>(index), key_);
+        auto const& [c0, c1, c2, c3] = counters.words;
+        return {c0[0], c1[0], c2[0], c3[0]};
+    }
+
+    /**
+     * @brief Get the uniform real number for an index
+     *
+     * @param index Index of the value
+     * @param lower Lower bound, inclusive
+     * @param upper Upper bound, exclusive
+     *
+     * @tparam RealType Floating point type
+     *
+     * @return Uniform real in range [lower, upper)
+     */
+    template <typename RealType>
+    [[nodiscard]] auto uniform_real(uint64_t index, RealType lower, RealType upper) const {
+        static_assert(std::is_floating_point_v<RealType>, "RealType must be a floating point type");
+        assert(lower < upper &&
+               "rsl::CounterRng::uniform_real: Lower bound must be less than upper bound");
+        auto const words = block(index);
+        return to_range(uint64_t(words[0]) << 32 | words[1], lower, upper);
+    }
+
+    /**
+     * @brief Get the uniform integer for an index
+     *
+     * @param index Index of the value
+     * @param lower Lower bound, inclusive
+     * @param upper Upper bound, inclusive
+     *
+     * @tparam IntType Integral type of at most 64 bits
+     *
+     * @return Uniform integer in range [lower, upper]
+     */
+    template <typename IntType>
+    [[nodiscard]] auto uniform_int(uint64_t index, IntType lower, IntType upper) const {
+        static_assert(std::is_integral_v<IntType> && sizeof(IntType) <= sizeof(uint64_t),
+                      "IntType must be an integral type of at most 64 bits");
+        assert(lower <= upper &&
+               "rsl::CounterRng::uniform_int: Lower bound must be less than or equal to upper "
+               "bound");
+        auto const words = block(index);
+        auto const first = uint64_t(words[0]) << 32 | words[1];
+        auto const second = uint64_t(words[2]) << 32 | words[3];
+        auto const offset = uint64_t(lower);
+        auto const range = uint64_t(upper) - offset + 1;  // Zero if all 64 bit values are in range
+        if (range == 0) return IntType(first);
+
+        // Lemire's method with the second half of the block as the one redraw. Both halves being
+        // rejected has probability below (range / 2^64)^2, and only then is the result biased.
+        auto const threshold = (0 - range) % range;
+        auto const bits = first * range < threshold ? second : first;
+        return IntType(offset + detail::mulhi(bits, range));
+    }
+
+    /**
+     * @brief Get the uniformly distributed random unit quaternion for an index
+     * @param index Index of the quaternion
+     * @return Random unit quaternion
+     */
+    [[nodiscard]] auto random_unit_quaternion(uint64_t index) const -> Eigen::Quaterniond {
+        constexpr auto two_pi = 6.283185307179586477;
+
+        // From "Uniform Random Rotations", Ken Shoemake, Graphics Gems III, pg. 124-132
+        auto const words = block(index);
+        auto const x0 = detail::to_unit_interval<double>(uint64_t(words[0]) << 32 | words[1]);
+        auto const t1 = two_pi * double(words[2]) * 0x1.0p-32;
+        auto const t2 = two_pi * double(words[3]) * 0x1.0p-32;
+        auto const r1 = std::sqrt(1 - x0);
+        auto const r2 = std::sqrt(x0);
+        return Eigen::Quaterniond(r2 * std::cos(t2), r1 * std::sin(t1), r1 * std::cos(t1),
+                                  r2 * std::sin(t2));
+    }
+
+    /**
+     * @brief Fill a span with the uniform real numbers for consecutive indices
+     *
+     * Equivalent to values[i] = uniform_real(first_index + i, lower, upper), but computes several
+     * blocks at once so the Philox rounds are vectorized.
+     *
+     * @param first_index Index of the first value
+     * @param values Span to fill
+     * @param lower Lower bound, inclusive
+     * @param upper Upper bound, exclusive
+     */
+    template <typename T, size_t extent>
+    void fill_uniform_real(uint64_t first_index, tcb::span<T, extent> values,
+                           std::remove_cv_t<T> lower, std::remove_cv_t<T> upper) const {
+        static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+        assert(lower < upper &&
+               "rsl::CounterRng::fill_uniform_real: Lower bound must be less than upper bound");
+        constexpr auto lanes = size_t(16);
+        auto const scale = upper - lower;
+        auto const largest = std::nextafter(upper, lower);
+        for (size_t begin = 0; begin < values.size(); begin += lanes) {
+            auto const counters =
+                detail::philox4x32_10(counter_lanes<lanes>(first_index + begin), key_);
+            auto const& [c0, c1, c2, c3] = counters.words;
+            auto const count = std::min(lanes, values.size() - begin);
+            for (size_t i = 0; i < count; ++i) {
+                auto const bits = uint64_t(c0[i]) << 32 | c1[i];
+                values[begin + i] =
+                    std::min(lower + detail::to_unit_interval<T>(bits) * scale, largest);
+            }
+        }
+    }
+
+   private:
+    template <size_t lanes>
+    [[nodiscard]] constexpr auto counter_lanes(uint64_t first_index) const
+        -> detail::PhiloxLanes<lanes> {
+        auto counters = detail::PhiloxLanes<lanes>();
+        for (size_t i = 0; i < lanes; ++i) {
+            auto const index = first_index + i;
+            counters.words[0][i] = uint32_t(index);
+            counters.words[1][i] = uint32_t(index >> 32);
+            counters.words[2][i] = stream_[0];
+            counters.words[3][i] = stream_[1];
+        }
+        return counters;
+    }
+
+    // Must match the conversion in fill_uniform_real
+    template <typename T>
+    [[nodiscard]] static auto to_range(uint64_t bits, T lower, T upper) -> T {
+        auto const value = lower + detail::to_unit_interval<T>(bits) * (upper - lower);
+        return std::min(value, std::nextafter(upper, lower));  // Rounding may otherwise reach upper
+    }
+};
+
+}  // namespace rsl
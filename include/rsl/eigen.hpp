@@ -0,0 +1,188 @@
+#pragma once
+
+#include <rsl/seq_lock.hpp>
+#include <rsl/static_vector.hpp>
+#include <rsl/strong_type.hpp>
+
+#include <rclcpp/parameter.hpp>
+#include <tcb_span/span.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <type_traits>
+#include <vector>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @brief View a span as an Eigen column vector without copying. Example usage:
+ *
+ * @code
+ * auto const positions = std::array{0.1, 0.2, 0.3};
+ * auto const map = rsl::as_eigen(tcb::span(positions)); // Eigen::Map<Eigen::Vector3d const>
+ * auto const norm = map.norm();
+ * @endcode
+ *
+ * Spans with a static extent map to a fixed-size vector, otherwise the vector is dynamically
+ * sized. The map is const if the span's element type is const.
+ *
+ * @param span Contiguous elements to view
+ *
+ * @return Eigen::Map over the span's data
+ */
+template <typename T, size_t extent>
+[[nodiscard]] auto as_eigen(tcb::span<T, extent> span) {
+    static_assert(std::is_arithmetic_v<std::remove_const_t<T>>, "T must be an arithmetic type");
+    constexpr auto rows = extent == tcb::dynamic_extent ? Eigen::Dynamic : int(extent);
+    using Vector = Eigen::Matrix<std::remove_const_t<T>, rows, 1>;
+    using Map = Eigen::Map<std::conditional_t<std::is_const_v<T>, Vector const, Vector>>;
+    return Map(span.data(), Eigen::Index(span.size()));
+}
+
+/**
+ * @brief View a span of strong types as an Eigen column vector of their underlying values without
+ * copying. Example usage:
+ *
+ * @code
+ * using Radians = rsl::StrongType<double, struct RadiansTag>;
+ * auto angles = std::vector{Radians(0.1), Radians(0.2)};
+ * rsl::as_eigen(angles) *= 2.; // Eigen::Map<Eigen::VectorXd>
+ * @endcode
+ */
+template <typename T, typename Tag, size_t extent>
+[[nodiscard]] auto as_eigen(tcb::span<StrongType<T, Tag>, extent> span) {
+    return as_eigen(unwrap_span(span));
+}
+
+/**
+ * @brief View a span of const strong types as a const Eigen column vector without copying
+ */
+template <typename T, typename Tag, size_t extent>
+[[nodiscard]] auto as_eigen(tcb::span<StrongType<T, Tag> const, extent> span) {
+    return as_eigen(unwrap_span(span));
+}
+
+/**
+ * @brief View a std::vector as a dynamically sized Eigen column vector without copying
+ */
+template <typename T>
+[[nodiscard]] auto as_eigen(std::vector<T>& vector) {
+    return as_eigen(tcb::span<T>(vector.data(), vector.size()));
+}
+
+/**
+ * @brief View a std::vector as a dynamically sized const Eigen column vector without copying
+ */
+template <typename T>
+[[nodiscard]] auto as_eigen(std::vector<T> const& vector) {
+    return as_eigen(tcb::span<T const>(vector.data(), vector.size()));
+}
+
+/**
+ * @brief Mapping a temporary would leave the map dangling
+ */
+template <typename T>
+auto as_eigen(std::vector<T>&& vector) = delete;
+
+/**
+ * @brief View a StaticVector as an Eigen column vector without copying
+ *
+ * The vector is dynamically sized with a maximum size equal to the capacity, so temporaries Eigen
+ * creates from it live on the stack. Storage of arithmetic types is 16 byte aligned, which is
+ * passed on to Eigen so it can use aligned loads.
+ */
+template <typename T, size_t capacity>
+[[nodiscard]] auto as_eigen(StaticVector<T, capacity>& static_vector) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor, int(capacity), 1>;
+    auto const span = tcb::span<T>(static_vector);
+    return Eigen::Map<Vector, Eigen::Aligned16>(span.data(), Eigen::Index(span.size()));
+}
+
+/**
+ * @brief View a StaticVector as a const Eigen column vector without copying
+ */
+template <typename T, size_t capacity>
+[[nodiscard]] auto as_eigen(StaticVector<T, capacity> const& static_vector) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor, int(capacity), 1>;
+    auto const span = tcb::span<T const>(static_vector);
+    return Eigen::Map<Vector const, Eigen::Aligned16>(span.data(), Eigen::Index(span.size()));
+}
+
+/**
+ * @brief View a StaticVector of strong types as an Eigen column vector of their underlying values
+ * without copying
+ *
+ * Unlike StaticVectors of arithmetic types, the storage is only aligned like T.
+ */
+template <typename T, typename Tag, size_t capacity>
+[[nodiscard]] auto as_eigen(StaticVector<StrongType<T, Tag>, capacity>& static_vector) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor, int(capacity), 1>;
+    auto const span = unwrap_span(static_vector);
+    return Eigen::Map<Vector>(span.data(), Eigen::Index(span.size()));
+}
+
+/**
+ * @brief View a StaticVector of strong types as a const Eigen column vector without copying
+ */
+template <typename T, typename Tag, size_t capacity>
+[[nodiscard]] auto as_eigen(StaticVector<StrongType<T, Tag>, capacity> const& static_vector) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    using Vector = Eigen::Matrix<T, Eigen::Dynamic, 1, Eigen::ColMajor, int(capacity), 1>;
+    auto const span = unwrap_span(static_vector);
+    return Eigen::Map<Vector const>(span.data(), Eigen::Index(span.size()));
+}
+
+/**
+ * @brief Mapping a temporary would leave the map dangling
+ */
+template <typename T, size_t capacity>
+auto as_eigen(StaticVector<T, capacity>&& static_vector) = delete;
+
+/**
+ * @brief View an array parameter as a const Eigen column vector without copying
+ * @pre rclcpp::Parameter must be an array type
+ * @tparam T Interior type of array; e.g. for parameter type double_array, T = double
+ * @return Eigen::Map over the parameter's storage, valid as long as the parameter is
+ */
+template <typename T>
+[[nodiscard]] auto as_eigen(rclcpp::Parameter const& parameter) {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                  "T must be an arithmetic type other than bool");
+    auto const& values = parameter.get_value<std::vector<T>>();
+    return as_eigen(tcb::span<T const>(values.data(), values.size()));
+}
+
+/**
+ * @brief Mapping a temporary would leave the map dangling
+ */
+template <typename T>
+auto as_eigen(rclcpp::Parameter&& parameter) = delete;
+
+/**
+ * @brief Fixed-size Eigen matrices can be copied with std::memcpy, e.g. for rsl::SeqLock
+ */
+template <typename Scalar, int rows, int cols, int options, int max_rows, int max_cols>
+struct is_bitwise_copyable<Eigen::Matrix<Scalar, rows, cols, options, max_rows, max_cols>>
+    : std::bool_constant<rows != Eigen::Dynamic && cols != Eigen::Dynamic &&
+                         std::is_trivially_copyable_v<Scalar>> {};
+
+/**
+ * @brief Eigen transforms can be copied with std::memcpy, e.g. for rsl::SeqLock
+ */
+template <typename Scalar, int dim, int mode, int options>
+struct is_bitwise_copyable<Eigen::Transform<Scalar, dim, mode, options>>
+    : std::is_trivially_copyable<Scalar> {};
+
+/**
+ * @brief Eigen quaternions can be copied with std::memcpy, e.g. for rsl::SeqLock
+ */
+template <typename Scalar, int options>
+struct is_bitwise_copyable<Eigen::Quaternion<Scalar, options>>
+    : std::is_trivially_copyable<Scalar> {};
+
+}  // namespace rsl
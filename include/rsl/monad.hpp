@@ -2,15 +2,62 @@
 
 #include <tl/expected.hpp>
 
+#include <functional>
 #include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace rsl {
 
 /** @file */
 
+template <typename>
+constexpr inline bool is_optional_impl = false;
+template <typename T>
+constexpr inline bool is_optional_impl<std::optional<T>> = true;
+template <typename T>
+constexpr inline bool is_optional = is_optional_impl<std::remove_cv_t<std::remove_reference_t<T>>>;
+
+template <typename>
+constexpr inline bool is_expected_impl = false;
+template <typename T, typename E>
+constexpr inline bool is_expected_impl<tl::expected<T, E>> = true;
+template <typename T>
+constexpr inline bool is_expected = is_expected_impl<std::remove_cv_t<std::remove_reference_t<T>>>;
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+template <typename>
+constexpr inline bool is_reference_wrapper = false;
+template <typename T>
+constexpr inline bool is_reference_wrapper<std::reference_wrapper<T>> = true;
+
+// Pass the value held by a monad on to the next function, unwrapping std::reference_wrapper so
+// stages can return references to data they do not own
+template <typename T>
+constexpr decltype(auto) unwrap_reference(T&& value) {
+    if constexpr (is_reference_wrapper<std::remove_cv_t<std::remove_reference_t<T>>>)
+        return value.get();
+    else
+        return std::forward<T>(value);
+}
+
+template <typename Fn, typename Arg>
+using bind_result_t =
+    std::invoke_result_t<Fn, decltype(unwrap_reference(std::declval<Arg>()))>;
+}  // namespace detail
+/**
+ * @endcond
+ */
+
 /**
  * @brief Monad optional bind
  *
+ * The value is passed to fn by const reference, so it is only copied if fn takes it by value. If
+ * the optional holds a std::reference_wrapper, fn is passed the reference it holds.
+ *
  * @param opt Input optional
  * @param fn  Function, must return a optional
  *
@@ -21,16 +68,35 @@ namespace rsl {
  */
 template <typename T, typename Fn>
 [[nodiscard]] constexpr auto mbind(std::optional<T> const& opt,
-                                   Fn fn) -> std::invoke_result_t<Fn, T> {
-    static_assert(std::is_convertible_v<std::nullopt_t, std::invoke_result_t<Fn, T>>,
+                                   Fn&& fn) -> detail::bind_result_t<Fn, T const&> {
+    static_assert(std::is_convertible_v<std::nullopt_t, detail::bind_result_t<Fn, T const&>>,
                   "Fn must return a std::optional");
-    if (opt) return fn(opt.value());
-    return std::invoke_result_t<Fn, T>{std::nullopt};
+    if (opt) return std::forward<Fn>(fn)(detail::unwrap_reference(*opt));
+    return detail::bind_result_t<Fn, T const&>{std::nullopt};
+}
+
+/**
+ * @brief Monad optional bind of an rvalue, which moves the value into fn. Example usage:
+ *
+ * @code
+ * auto const cloud = load_cloud(path) | remove_outliers | downsample; // Moved, never copied
+ * @endcode
+ */
+template <typename T, typename Fn>
+[[nodiscard]] constexpr auto mbind(std::optional<T>&& opt,
+                                   Fn&& fn) -> detail::bind_result_t<Fn, T&&> {
+    static_assert(std::is_convertible_v<std::nullopt_t, detail::bind_result_t<Fn, T&&>>,
+                  "Fn must return a std::optional");
+    if (opt) return std::forward<Fn>(fn)(detail::unwrap_reference(*std::move(opt)));
+    return detail::bind_result_t<Fn, T&&>{std::nullopt};
 }
 
 /**
  * @brief Monad tl::expected<T,E>
  *
+ * The value is passed to fn by const reference, so it is only copied if fn takes it by value. If
+ * the expected holds a std::reference_wrapper, fn is passed the reference it holds.
+ *
  * @param exp tl::expected<T,E> input
  * @param fn  Function to apply
  *
@@ -42,11 +108,22 @@ template <typename T, typename Fn>
  */
 template <typename T, typename E, typename Fn>
 [[nodiscard]] constexpr auto mbind(tl::expected<T, E> const& exp,
-                                   Fn fn) -> std::invoke_result_t<Fn, T> {
-    if (exp) return fn(exp.value());
+                                   Fn&& fn) -> detail::bind_result_t<Fn, T const&> {
+    if (exp) return std::forward<Fn>(fn)(detail::unwrap_reference(*exp));
     return tl::unexpected(exp.error());
 }
 
+/**
+ * @brief Monad tl::expected<T,E> of an rvalue, which moves the value into fn or moves the error
+ * into the result
+ */
+template <typename T, typename E, typename Fn>
+[[nodiscard]] constexpr auto mbind(tl::expected<T, E>&& exp,
+                                   Fn&& fn) -> detail::bind_result_t<Fn, T&&> {
+    if (exp) return std::forward<Fn>(fn)(detail::unwrap_reference(*std::move(exp)));
+    return tl::unexpected(std::move(exp).error());
+}
+
 /**
  * @brief Monadic try, used to lift a function that throws an exception into one that returns an
  * tl::expected<T, std::exception_ptr>
@@ -65,38 +142,74 @@ template <typename Fn>
 }
 
 /**
- * @brief Monadic compose two monad functions
- *
- * @param fn First function
- * @param g  Second function
- *
- * @tparam Fn Type of the first function
- * @tparam G  Type of the second function
- *
- * @return A functional composition of two monad functions
+ * @cond DETAIL
  */
-template <typename Fn, typename G>
-[[nodiscard]] constexpr auto mcompose(Fn fn, G g) {
-    return [=](auto value) { return mbind(fn(value), g); };
+namespace detail {
+// Binds the stages of a composition in order in a fold expression. Found by unqualified lookup
+// only from inside rsl::detail.
+template <typename Monad, typename Fn,
+          typename = std::enable_if_t<is_optional<Monad> || is_expected<Monad>>>
+[[nodiscard]] constexpr auto operator>>=(Monad&& monad, Fn const& fn) {
+    return mbind(std::forward<Monad>(monad), fn);
 }
 
+template <size_t index, typename Fn>
+struct Stage {
+    Fn fn;
+};
+
+template <typename Indices, typename... Fns>
+class Composition;
+
+// The stages are stored side by side, rather than in a recursive std::tuple, to keep the closure
+// and its accessors flat
+template <size_t... indices, typename... Fns>
+class Composition<std::index_sequence<indices...>, Fns...> : Stage<indices, Fns>... {
+    template <size_t index, typename Fn>
+    [[nodiscard]] static constexpr auto stage(Stage<index, Fn> const& holder) -> Fn const& {
+        return holder.fn;
+    }
+
+   public:
+    constexpr explicit Composition(Fns... fns) : Stage<indices, Fns>{std::move(fns)}... {}
+
+    template <typename T>
+    [[nodiscard]] constexpr auto operator()(T&& value) const {
+        return call(std::forward<T>(value), stage<indices>(*this)...);
+    }
+
+   private:
+    template <typename T, typename First, typename... Rest>
+    [[nodiscard]] static constexpr auto call(T&& value, First const& first, Rest const&... rest) {
+        return (first(std::forward<T>(value)) >>= ... >>= rest);
+    }
+};
+}  // namespace detail
 /**
- * @brief Variadic mcompose
+ * @endcond
+ */
+
+/**
+ * @brief Monadic compose of monad functions
  *
- * @param t    First function
- * @param g    Second function
- * @param vars Rest of the functions
+ * The functions are stored side by side in one closure and bound in order by a fold expression,
+ * so long chains do not nest closure types or copy the functions when called. The composition
+ * can be evaluated at compile time if the functions can.
  *
- * @tparam T  Type of the first function
- * @tparam G  Type of the second function
- * @tparam Ts Types of the rest of the functions
+ * @param fn  First function
+ * @param g   Second function
+ * @param fns Rest of the functions
  *
- * @return A functional composition of variadic monad functions
+ * @tparam Fn  Type of the first function
+ * @tparam G   Type of the second function
+ * @tparam Fns Types of the rest of the functions
+ *
+ * @return A functional composition of the monad functions
  */
-template <typename T, typename G, typename... Ts>
-[[nodiscard]] constexpr auto mcompose(T t, G g, Ts... vars) {
-    auto exp = mcompose(t, g);
-    return mcompose(exp, vars...);
+template <typename Fn, typename G, typename... Fns>
+[[nodiscard]] constexpr auto mcompose(Fn fn, G g, Fns... fns) {
+    return detail::Composition<std::index_sequence_for<Fn, G, Fns...>, Fn, G, Fns...>(
+        std::move(fn), std::move(g), std::move(fns)...);
 }
 
 /**
@@ -145,48 +258,26 @@ template <typename E, typename... Args>
     return maybe;
 }
 
-template <typename>
-constexpr inline bool is_optional_impl = false;
-template <typename T>
-constexpr inline bool is_optional_impl<std::optional<T>> = true;
-template <typename T>
-constexpr inline bool is_optional = is_optional_impl<std::remove_cv_t<std::remove_reference_t<T>>>;
-
 }  // namespace rsl
 
 /**
  * @brief Overload of the | operator as bind
  *
- * @param opt Input optional
- * @param fn  Function
+ * Rvalue inputs are moved into fn, so values flow through a chain of stages without copies.
  *
- * @tparam T  Input type
- * @tparam Fn Function
+ * @param monad Input std::optional or tl::expected<T,E> value
+ * @param fn    Function to apply
  *
- * @return Return type of f
- */
-template <typename T, typename Fn, typename = std::enable_if_t<rsl::is_optional<T>>,
-          typename = std::enable_if_t<std::is_invocable_v<
-              Fn, typename std::remove_cv_t<std::remove_reference_t<T>>::value_type>>>
-[[nodiscard]] constexpr auto operator|(T&& opt, Fn&& fn) {
-    return rsl::mbind(std::forward<T>(opt), std::forward<Fn>(fn));
-}
-
-/**
- * @brief Overload of the | operator as bind
- *
- * @param exp Input tl::expected<T,E> value
- * @param fn  Function to apply
- *
- * @tparam T  Type for the input expected
- * @tparam E  Error type
+ * @tparam T  Type of the input
  * @tparam Fn Function
  *
  * @return Return type of fn
  */
-template <typename T, typename E, typename Fn>
-[[nodiscard]] constexpr auto operator|(tl::expected<T, E> const& exp, Fn fn) {
-    return rsl::mbind(exp, fn);
+template <typename T, typename Fn,
+          typename = std::enable_if_t<rsl::is_optional<T> || rsl::is_expected<T>>,
+          typename = rsl::detail::bind_result_t<Fn, decltype(*std::declval<T>())>>
+[[nodiscard]] constexpr auto operator|(T&& monad, Fn&& fn) {
+    return rsl::mbind(std::forward<T>(monad), std::forward<Fn>(fn));
 }
 
 /**
@@ -200,7 +291,8 @@ template <typename T, typename E, typename Fn>
  *
  * @return Return the result of invoking the function on val
  */
-template <typename T, typename Fn, typename = std::enable_if_t<!rsl::is_optional<T>>>
+template <typename T, typename Fn,
+          typename = std::enable_if_t<!rsl::is_optional<T> && !rsl::is_expected<T>>>
 [[nodiscard]] constexpr auto operator|(T&& val, Fn&& fn) ->
     typename std::enable_if_t<std::is_invocable_v<Fn, T>, std::invoke_result_t<Fn, T>> {
     return std::invoke(std::forward<Fn>(fn), std::forward<T>(val));
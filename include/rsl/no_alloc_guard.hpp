@@ -0,0 +1,76 @@
+#pragma once
+
+#include <rsl/export.hpp>
+
+#include <cstddef>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @brief Scoped guard for detecting heap allocations in real-time sections. Example usage:
+ *
+ * @code
+ * auto const guard = rsl::NoAllocGuard();
+ * auto const value = queue.pop();
+ * assert(guard.allocation_count() == 0);
+ * @endcode
+ *
+ * While a guard is alive, every call to the global operator new made by the thread that created it
+ * is either counted or aborts the program, depending on the policy. Allocations made by other
+ * threads are not affected. Guards may be nested, in which case the innermost policy applies.
+ *
+ * Allocation tracking is only compiled in when RSL is configured with the
+ * RSL_ENABLE_NO_ALLOC_GUARD option, which replaces the global operator new and operator delete.
+ * Direct calls to malloc are not intercepted. When the option is off the guard does nothing and
+ * allocation_count() always returns zero; check rsl::NoAllocGuard::enabled before relying on it.
+ */
+class RSL_EXPORT NoAllocGuard {
+   public:
+    /**
+     * @brief What to do when an allocation is made while the guard is active
+     */
+    enum class Policy {
+        count,  ///< Count the allocation and carry on
+        abort,  ///< Print a message to stderr and call std::abort
+    };
+
+#ifdef RSL_ENABLE_NO_ALLOC_GUARD
+    static constexpr bool enabled = true;
+#else
+    /**
+     * @brief True if RSL was built with allocation tracking
+     */
+    static constexpr bool enabled = false;
+#endif
+
+    /**
+     * @brief Start guarding the current thread
+     * @param policy What to do when an allocation is made
+     */
+    explicit NoAllocGuard(Policy policy = Policy::count);
+
+    /**
+     * @brief Stop guarding the current thread, restoring the policy of any enclosing guard
+     */
+    ~NoAllocGuard();
+
+    NoAllocGuard(NoAllocGuard const&) = delete;
+    NoAllocGuard(NoAllocGuard&&) = delete;
+    NoAllocGuard& operator=(NoAllocGuard const&) = delete;
+    NoAllocGuard& operator=(NoAllocGuard&&) = delete;
+
+    /**
+     * @brief Get the number of allocations made by this thread since the guard was created
+     * @return Allocation count
+     */
+    [[nodiscard]] auto allocation_count() const -> size_t;
+
+   private:
+    size_t initial_count_;
+    Policy previous_policy_;
+    bool previous_active_;
+};
+
+}  // namespace rsl
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @brief Fixed capacity pool of reusable objects that can be acquired and released from any
+ * thread without locking. Example usage:
+ *
+ * @code
+ * auto pool = rsl::ObjectPool<std::vector<double>>(64, std::vector<double>(1024));
+ * auto buffer = pool.acquire(); // std::unique_ptr returned to the pool when destroyed
+ * queue.push(std::move(buffer));
+ * @endcode
+ *
+ * All objects are constructed up front as copies of a prototype. Released objects keep their state,
+ * so buffers keep their capacity and callers should reset contents they rely on. When every pooled
+ * object is in use acquire() falls back to heap allocating a copy of the prototype, which is
+ * deleted rather than pooled when released.
+ *
+ * The free list is a Treiber stack of node indices tagged with a counter to prevent ABA. Handles
+ * must not outlive the pool.
+ */
+template <typename T>
+class ObjectPool {
+    static constexpr auto empty_index = UINT32_MAX;
+
+    struct Node {
+        Node(T const& prototype, uint32_t next_index) : value(prototype), next(next_index) {}
+
+        T value;
+        std::atomic<uint32_t> next;
+    };
+
+    // Nodes are copy constructed in place in raw storage, so T needs no default constructor or
+    // assignment and each object is constructed once
+    struct NodesDeleter {
+        size_t capacity = 0;
+        size_t constructed = 0;
+
+        void operator()(Node* nodes) const {
+            for (size_t i = 0; i < constructed; ++i) nodes[i].~Node();
+            std::allocator<Node>().deallocate(nodes, capacity);
+        }
+    };
+
+    T prototype_;
+    size_t capacity_;
+    std::unique_ptr<Node[], NodesDeleter> nodes_;
+    std::atomic<uint64_t> head_;  // Tag in the upper 32 bits, node index in the lower 32 bits
+
+   public:
+    /**
+     * @brief Returns pooled objects to the pool and deletes overflow objects
+     */
+    class Deleter {
+        ObjectPool* pool_ = nullptr;
+        uint32_t index_ = empty_index;
+
+       public:
+        Deleter() = default;
+
+        /**
+         * @brief Construct a deleter for a pooled object, or an overflow object if index is
+         * empty_index
+         */
+        Deleter(ObjectPool* pool, uint32_t index) : pool_(pool), index_(index) {}
+
+        /**
+         * @brief Release the object
+         */
+        void operator()(T* value) const {
+            if (index_ == empty_index)
+                delete value;  // NOLINT(cppcoreguidelines-owning-memory)
+            else
+                pool_->release(index_);
+        }
+    };
+
+    /**
+     * @brief Owning handle to an object from the pool
+     */
+    using Handle = std::unique_ptr<T, Deleter>;
+
+    /**
+     * @brief Construct the pool and all of its objects
+     * @param capacity Number of objects to preallocate
+     * @param prototype Object each pooled object is copied from
+     */
+    explicit ObjectPool(size_t capacity, T const& prototype = T())
+        : prototype_(prototype),
+          capacity_(capacity),
+          nodes_(std::allocator<Node>().allocate(capacity), NodesDeleter{capacity, 0}),
+          head_(capacity == 0 ? empty_index : 0) {
+        assert(capacity < empty_index &&
+               "rsl::ObjectPool::ObjectPool: Capacity must be less than UINT32_MAX");
+        for (size_t i = 0; i < capacity; ++i) {
+            auto const next = i + 1 < capacity ? uint32_t(i + 1) : empty_index;
+            ::new (static_cast<void*>(nodes_.get() + i)) Node(prototype, next);
+            ++nodes_.get_deleter().constructed;
+        }
+    }
+
+    ObjectPool(ObjectPool const&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ObjectPool& operator=(ObjectPool const&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+    ~ObjectPool() = default;
+
+    /**
+     * @brief Get the number of pooled objects
+     */
+    [[nodiscard]] auto capacity() const { return capacity_; }
+
+    /**
+     * @brief Take an object from the pool, heap allocating one if the pool is exhausted
+     * @return Handle that returns the object to the pool when destroyed
+     */
+    [[nodiscard]] auto acquire() -> Handle {
+        auto head = head_.load(std::memory_order_acquire);
+        while (true) {
+            auto const index = uint32_t(head);
+            if (index == empty_index) return Handle(new T(prototype_), Deleter());
+            auto const next = nodes_[index].next.load(std::memory_order_relaxed);
+            if (head_.compare_exchange_weak(head, tagged(head, next), std::memory_order_acquire,
+                                            std::memory_order_acquire))
+                return Handle(&nodes_[index].value, Deleter(this, index));
+        }
+    }
+
+   private:
+    [[nodiscard]] static auto tagged(uint64_t previous_head, uint32_t index) -> uint64_t {
+        return (((previous_head >> 32) + 1) << 32) | index;
+    }
+
+    void release(uint32_t index) {
+        auto head = head_.load(std::memory_order_relaxed);
+        do {
+            nodes_[index].next.store(uint32_t(head), std::memory_order_relaxed);
+        } while (!head_.compare_exchange_weak(head, tagged(head, index), std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+};
+
+}  // namespace rsl
@@ -10,6 +10,7 @@
 #include <tl/expected.hpp>
 
 #include <fmt/ranges.h>
+#include <string_view>
 #include <type_traits>
 
 namespace rsl {
@@ -36,26 +37,40 @@ template <typename T>
 
 template <typename T, typename Fn>
 [[nodiscard]] auto size_compare(rclcpp::Parameter const& parameter, size_t const size,
-                                std::string const& predicate_description,
+                                std::string_view predicate_description,
                                 Fn const& predicate) -> tl::expected<void, std::string> {
     static constexpr auto format_string = "Length of parameter '{}' is '{}' but must be {} '{}'";
     switch (parameter.get_type()) {
         case rclcpp::ParameterType::PARAMETER_STRING:
-            if (auto value = parameter.get_value<std::string>(); !predicate(value.size(), size))
+            if (auto const& value = parameter.get_value<std::string>();
+                !predicate(value.size(), size))
                 return tl::unexpected(fmt::format(format_string, parameter.get_name(), value.size(),
                                                   predicate_description, size));
             break;
         default:
-            if (auto value = parameter.get_value<std::vector<T>>(); !predicate(value.size(), size))
+            if (auto const& value = parameter.get_value<std::vector<T>>();
+                !predicate(value.size(), size))
                 return tl::unexpected(fmt::format(format_string, parameter.get_name(), value.size(),
                                                   predicate_description, size));
     }
     return {};
 }
 
+// Index of the first value that is not valid, or the size if all are. is_valid must not throw if
+// the policy runs on more than one thread.
+template <typename T, typename Fn>
+[[nodiscard]] auto first_invalid(ParallelPolicy const& policy, std::vector<T> const& values,
+                                 Fn const& is_valid) -> size_t {
+    return parallel_find_first(policy, values.size(), [&](size_t begin, size_t end) {
+        for (; begin < end; ++begin)
+            if (!is_valid(values[begin])) return begin;
+        return end;
+    });
+}
+
 template <typename T, typename Fn>
 [[nodiscard]] auto compare(rclcpp::Parameter const& parameter, T const& value,
-                           std::string const& predicate_description,
+                           std::string_view predicate_description,
                            Fn const& predicate) -> tl::expected<void, std::string> {
     if (auto const param_value = parameter.get_value<T>(); !predicate(param_value, value))
         return tl::unexpected(fmt::format("Parameter '{}' with the value '{}' must be {} '{}'",
@@ -76,7 +91,17 @@ template <typename T, typename Fn>
  */
 template <typename T>
 [[nodiscard]] auto unique(rclcpp::Parameter const& parameter) -> tl::expected<void, std::string> {
-    if (is_unique(parameter.get_value<std::vector<T>>())) return {};
+    return unique<T>(ParallelPolicy{1}, parameter);
+}
+
+/**
+ * @brief Is every element of rclcpp::Parameter unique? Checked on several threads for large arrays
+ * @see rsl::is_unique(ParallelPolicy const&, Collection const&)
+ */
+template <typename T>
+[[nodiscard]] auto unique(ParallelPolicy const& policy, rclcpp::Parameter const& parameter)
+    -> tl::expected<void, std::string> {
+    if (is_unique(policy, parameter.get_value<std::vector<T>>())) return {};
     return tl::unexpected(
         fmt::format("Parameter '{}' must only contain unique values", parameter.get_name()));
 }
@@ -90,13 +115,25 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto subset_of(rclcpp::Parameter const& parameter, std::vector<T> const& valid_values)
     -> tl::expected<void, std::string> {
+    return subset_of<T>(ParallelPolicy{1}, parameter, valid_values);
+}
+
+/**
+ * @brief Are the values in parameter a subset of the valid values? Checked on several threads for
+ * large arrays, reporting the first invalid entry
+ * @see rsl::ParallelPolicy
+ */
+template <typename T>
+[[nodiscard]] auto subset_of(ParallelPolicy const& policy, rclcpp::Parameter const& parameter,
+                             std::vector<T> const& valid_values)
+    -> tl::expected<void, std::string> {
     auto const& values = parameter.get_value<std::vector<T>>();
-    for (auto const& value : values)
-        if (!contains(valid_values, value))
-            return tl::unexpected(
-                fmt::format("Entry '{}' in parameter '{}' is not in the set '{{{}}}'", value,
-                            parameter.get_name(), fmt::join(valid_values, ", ")));
-    return {};
+    auto const index = detail::first_invalid(
+        policy, values, [&](T const& value) { return contains(valid_values, value); });
+    if (index == values.size()) return {};
+    return tl::unexpected(fmt::format("Entry '{}' in parameter '{}' is not in the set '{{{}}}'",
+                                      T(values[index]), parameter.get_name(),
+                                      fmt::join(valid_values, ", ")));
 }
 
 /**
@@ -144,12 +181,13 @@ template <typename T>
     -> tl::expected<void, std::string> {
     switch (parameter.get_type()) {
         case rclcpp::ParameterType::PARAMETER_STRING:
-            if (auto param_value = parameter.get_value<std::string>(); param_value.empty())
+            if (auto const& param_value = parameter.get_value<std::string>(); param_value.empty())
                 return tl::unexpected(
                     fmt::format("Parameter '{}' cannot be empty", parameter.get_name()));
             break;
         default:
-            if (auto param_value = parameter.get_value<std::vector<T>>(); param_value.empty())
+            if (auto const& param_value = parameter.get_value<std::vector<T>>();
+                param_value.empty())
                 return tl::unexpected(
                     fmt::format("Parameter '{}' cannot be empty", parameter.get_name()));
     }
@@ -165,14 +203,26 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto element_bounds(rclcpp::Parameter const& parameter, T const& lower,
                                   T const& upper) -> tl::expected<void, std::string> {
+    return element_bounds<T>(ParallelPolicy{1}, parameter, lower, upper);
+}
+
+/**
+ * @brief Are all elements of parameter within the bounds (inclusive)? Checked on several threads
+ * for large arrays, reporting the first violation
+ * @see rsl::ParallelPolicy
+ */
+template <typename T>
+[[nodiscard]] auto element_bounds(ParallelPolicy const& policy, rclcpp::Parameter const& parameter,
+                                  T const& lower, T const& upper)
+    -> tl::expected<void, std::string> {
     auto const& param_value = parameter.get_value<std::vector<T>>();
-    for (auto val : param_value)
-        if (val < lower || val > upper)
-            return tl::unexpected(
-                fmt::format("Value '{}' in parameter '{}' must be within bounds '[{}, {}]'",
-                            detail::stringify(val), parameter.get_name(), detail::stringify(lower),
-                            detail::stringify(upper)));
-    return {};
+    auto const index = detail::first_invalid(
+        policy, param_value, [&](T const& val) { return !(val < lower || val > upper); });
+    if (index == param_value.size()) return {};
+    return tl::unexpected(
+        fmt::format("Value '{}' in parameter '{}' must be within bounds '[{}, {}]'",
+                    detail::stringify(T(param_value[index])), parameter.get_name(),
+                    detail::stringify(lower), detail::stringify(upper)));
 }
 
 /**
@@ -184,13 +234,25 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto lower_element_bounds(rclcpp::Parameter const& parameter,
                                         T const& lower) -> tl::expected<void, std::string> {
+    return lower_element_bounds<T>(ParallelPolicy{1}, parameter, lower);
+}
+
+/**
+ * @brief Are all elements of parameter greater than lower bound? Checked on several threads for
+ * large arrays, reporting the first violation
+ * @see rsl::ParallelPolicy
+ */
+template <typename T>
+[[nodiscard]] auto lower_element_bounds(ParallelPolicy const& policy,
+                                        rclcpp::Parameter const& parameter, T const& lower)
+    -> tl::expected<void, std::string> {
     auto const& param_value = parameter.get_value<std::vector<T>>();
-    for (auto val : param_value)
-        if (val < lower)
-            return tl::unexpected(fmt::format(
-                "Value '{}' in parameter '{}' must be above lower bound of '{}'",
-                detail::stringify(val), parameter.get_name(), detail::stringify(lower)));
-    return {};
+    auto const index =
+        detail::first_invalid(policy, param_value, [&](T const& val) { return !(val < lower); });
+    if (index == param_value.size()) return {};
+    return tl::unexpected(fmt::format(
+        "Value '{}' in parameter '{}' must be above lower bound of '{}'",
+        detail::stringify(T(param_value[index])), parameter.get_name(), detail::stringify(lower)));
 }
 
 /**
@@ -202,13 +264,25 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto upper_element_bounds(rclcpp::Parameter const& parameter,
                                         T const& upper) -> tl::expected<void, std::string> {
+    return upper_element_bounds<T>(ParallelPolicy{1}, parameter, upper);
+}
+
+/**
+ * @brief Are all elements of parameter less than some upper bound? Checked on several threads for
+ * large arrays, reporting the first violation
+ * @see rsl::ParallelPolicy
+ */
+template <typename T>
+[[nodiscard]] auto upper_element_bounds(ParallelPolicy const& policy,
+                                        rclcpp::Parameter const& parameter, T const& upper)
+    -> tl::expected<void, std::string> {
     auto const& param_value = parameter.get_value<std::vector<T>>();
-    for (auto val : param_value)
-        if (val > upper)
-            return tl::unexpected(fmt::format(
-                "Value '{}' in parameter '{}' must be below upper bound of '{}'",
-                detail::stringify(val), parameter.get_name(), detail::stringify(upper)));
-    return {};
+    auto const index =
+        detail::first_invalid(policy, param_value, [&](T const& val) { return !(val > upper); });
+    if (index == param_value.size()) return {};
+    return tl::unexpected(fmt::format(
+        "Value '{}' in parameter '{}' must be below upper bound of '{}'",
+        detail::stringify(T(param_value[index])), parameter.get_name(), detail::stringify(upper)));
 }
 
 /**
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <rsl/export.hpp>
+
+#include <Eigen/Geometry>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @brief Halton low-discrepancy sequence. Example usage:
+ *
+ * @code
+ * auto const halton = rsl::Halton(3);
+ * auto const samples = halton.points(0, 1000); // 3 x 1000, each column in [0, 1)^3
+ * @endcode
+ *
+ * Dimension d of point n is the radical inverse of n in the d-th prime base. Points fill the unit
+ * cube much more evenly than independent uniform samples, so fewer are needed to cover it. Point 0
+ * is the origin. Quality degrades in high dimensions; prefer rsl::Sobol beyond about ten.
+ */
+class RSL_EXPORT Halton {
+    std::vector<uint32_t> bases_;
+
+   public:
+    /**
+     * @brief Construct a sequence
+     * @param dimensions Number of dimensions of each point
+     */
+    explicit Halton(size_t dimensions);
+
+    /**
+     * @brief Get the number of dimensions of each point
+     */
+    [[nodiscard]] auto dimensions() const { return bases_.size(); }
+
+    /**
+     * @brief Get one coordinate of a point
+     * @param index Index of the point
+     * @param dimension Dimension of the coordinate
+     * @return Coordinate in [0, 1)
+     */
+    [[nodiscard]] auto value(uint64_t index, size_t dimension) const -> double;
+
+    /**
+     * @brief Get a point
+     * @param index Index of the point
+     * @return Point in [0, 1)^dimensions
+     */
+    [[nodiscard]] auto point(uint64_t index) const -> Eigen::VectorXd;
+
+    /**
+     * @brief Get consecutive points
+     * @param first_index Index of the first point
+     * @param count Number of points
+     * @return dimensions x count matrix with one point per column
+     */
+    [[nodiscard]] auto points(uint64_t first_index, size_t count) const -> Eigen::MatrixXd;
+};
+
+/**
+ * @brief Sobol low-discrepancy sequence with optional scrambling. Example usage:
+ *
+ * @code
+ * auto const sobol = rsl::Sobol(6, 42); // Scrambled with seed 42
+ * auto const samples = sobol.points(0, 1024); // 6 x 1024, each column in [0, 1)^6
+ * @endcode
+ *
+ * Uses the direction numbers of "Constructing Sobol Sequences with Better Two-Dimensional
+ * Projections", Joe and Kuo, 2008, in natural rather than Gray code order so any point can be
+ * computed directly from its index. Coordinates have 32 bits of resolution and the first 2^k
+ * points of each dimension stratify it into 2^k equal intervals.
+ *
+ * Scrambling applies a random linear matrix scramble and digital shift per dimension. This keeps
+ * the stratification while removing the structure of the unscrambled sequence, including its
+ * first point at the origin, and gives independent randomizations for different seeds.
+ */
+class RSL_EXPORT Sobol {
+    std::vector<std::array<uint32_t, 32>> directions_;
+    std::vector<uint32_t> shifts_;
+
+   public:
+    /**
+     * @brief Largest supported number of dimensions
+     */
+    static constexpr auto max_dimensions = size_t(21);
+
+    /**
+     * @brief Construct an unscrambled sequence
+     * @param dimensions Number of dimensions of each point, at most max_dimensions
+     */
+    explicit Sobol(size_t dimensions);
+
+    /**
+     * @brief Construct a scrambled sequence
+     * @param dimensions Number of dimensions of each point, at most max_dimensions
+     * @param seed Seed of the scramble
+     */
+    Sobol(size_t dimensions, uint64_t seed);
+
+    /**
+     * @brief Get the number of dimensions of each point
+     */
+    [[nodiscard]] auto dimensions() const { return directions_.size(); }
+
+    /**
+     * @brief Get one coordinate of a point
+     * @param index Index of the point, less than 2^32
+     * @param dimension Dimension of the coordinate
+     * @return Coordinate in [0, 1)
+     */
+    [[nodiscard]] auto value(uint64_t index, size_t dimension) const -> double;
+
+    /**
+     * @brief Get a point
+     * @param index Index of the point, less than 2^32
+     * @return Point in [0, 1)^dimensions
+     */
+    [[nodiscard]] auto point(uint64_t index) const -> Eigen::VectorXd;
+
+    /**
+     * @brief Get consecutive points
+     * @param first_index Index of the first point
+     * @param count Number of points, with first_index + count at most 2^32
+     * @return dimensions x count matrix with one point per column
+     */
+    [[nodiscard]] auto points(uint64_t first_index, size_t count) const -> Eigen::MatrixXd;
+};
+
+/**
+ * @brief Deterministic, nearly uniform grid of rotations. Example usage:
+ *
+ * @code
+ * auto const grid = rsl::SO3Grid(1); // 576 rotations, about 30 degrees apart
+ * for (size_t i = 0; i < grid.size(); ++i) try_orientation(grid.quaternion(i));
+ * @endcode
+ *
+ * From "Generating Uniform Incremental Grids on SO(3) Using the Hopf Fibration", Yershova et al.,
+ * 2010. Rotations are written in Hopf coordinates, a point on the sphere and an angle about it.
+ * The sphere is divided with the HEALPix equal area grid and the angle evenly, with the resolution
+ * of both doubling at each level. Level 0 has 72 rotations and each level has 8 times as many as
+ * the previous one.
+ */
+class RSL_EXPORT SO3Grid {
+    uint64_t resolution_;
+
+   public:
+    /**
+     * @brief Construct a grid
+     * @param level Refinement level, with 72 * 8^level rotations
+     */
+    explicit SO3Grid(size_t level);
+
+    /**
+     * @brief Get the number of rotations in the grid
+     */
+    [[nodiscard]] auto size() const -> size_t;
+
+    /**
+     * @brief Get a rotation of the grid
+     * @param index Index of the rotation, less than size()
+     * @return Unit quaternion
+     */
+    [[nodiscard]] auto quaternion(size_t index) const -> Eigen::Quaterniond;
+
+    /**
+     * @brief Get all rotations of the grid
+     * @return 4 x size() matrix of unit quaternions in Eigen's (x, y, z, w) coefficient order, as
+     * returned by rsl::random_unit_quaternions
+     */
+    [[nodiscard]] auto quaternions() const -> Eigen::Matrix4Xd;
+};
+
+}  // namespace rsl
@@ -71,7 +71,7 @@ class Queue {
         // If queue is empty after wait_time, return nothing
         if (!cv_.wait_for(lock, wait_time, [this] { return !queue_.empty(); })) return std::nullopt;
 
-        auto value = queue_.front();
+        auto value = std::move(queue_.front());
         queue_.pop();
         return value;
     }
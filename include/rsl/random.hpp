@@ -2,15 +2,331 @@
 
 #include <rsl/export.hpp>
 
+#include <tcb_span/span.hpp>
+
 #include <Eigen/Geometry>
+#include <array>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <optional>
 #include <random>
 #include <type_traits>
+#include <vector>
 
 namespace rsl {
 
 /** @file */
 
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+[[nodiscard]] constexpr auto rotl(uint64_t value, int shift) -> uint64_t {
+    return (value << shift) | (value >> ((64 - shift) & 63));
+}
+
+[[nodiscard]] constexpr auto rotr(uint64_t value, int shift) -> uint64_t {
+    return (value >> shift) | (value << ((64 - shift) & 63));
+}
+
+// High 64 bits of the 128 bit product
+[[nodiscard]] inline auto mulhi(uint64_t lhs, uint64_t rhs) -> uint64_t {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+    return uint64_t((uint128(lhs) * rhs) >> 64);
+#else
+    auto const lhs_lo = lhs & UINT32_MAX;
+    auto const lhs_hi = lhs >> 32;
+    auto const rhs_lo = rhs & UINT32_MAX;
+    auto const rhs_hi = rhs >> 32;
+    auto const hi_lo = lhs_hi * rhs_lo;
+    auto const cross = ((lhs_lo * rhs_lo) >> 32) + (hi_lo & UINT32_MAX) + lhs_lo * rhs_hi;
+    return lhs_hi * rhs_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+// Generate 64 bit words from a seed sequence
+template <size_t count>
+[[nodiscard]] auto generate_words(std::seed_seq& seed_sequence) {
+    auto halves = std::array<uint32_t, 2 * count>();
+    seed_sequence.generate(halves.begin(), halves.end());
+    auto words = std::array<uint64_t, count>();
+    for (size_t i = 0; i < count; ++i) words[i] = uint64_t(halves[2 * i]) << 32 | halves[2 * i + 1];
+    return words;
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief SplitMix64 random number generator
+ *
+ * Tiny state and very fast, with good statistical quality for its size. Mainly useful for
+ * expanding a single seed into the state of a larger generator.
+ */
+class SplitMix64 {
+    uint64_t state_;
+
+   public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Construct from a 64 bit seed
+     */
+    constexpr explicit SplitMix64(uint64_t seed = 0) : state_(seed) {}
+
+    /**
+     * @brief Construct from a seed sequence
+     */
+    explicit SplitMix64(std::seed_seq& seed_sequence)
+        : state_(detail::generate_words<1>(seed_sequence)[0]) {}
+
+    /**
+     * @brief Smallest value the generator produces
+     */
+    [[nodiscard]] static constexpr auto min() { return result_type(0); }
+
+    /**
+     * @brief Largest value the generator produces
+     */
+    [[nodiscard]] static constexpr auto max() { return UINT64_MAX; }
+
+    /**
+     * @brief Generate the next value
+     */
+    constexpr auto operator()() -> result_type {
+        auto z = state_ += 0x9e3779b97f4a7c15;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+};
+
+/**
+ * @brief xoshiro256++ random number generator
+ *
+ * 32 bytes of state, very fast and passes all known statistical tests. From "Scrambled Linear
+ * Pseudorandom Number Generators", Blackman and Vigna, 2021.
+ */
+class Xoshiro256PlusPlus {
+    std::array<uint64_t, 4> state_{};
+
+   public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Construct from a 64 bit seed, expanded into the full state with rsl::SplitMix64
+     */
+    constexpr explicit Xoshiro256PlusPlus(uint64_t seed = 0) {
+        auto splitmix = SplitMix64(seed);
+        for (auto& word : state_) word = splitmix();
+    }
+
+    /**
+     * @brief Construct from a seed sequence
+     */
+    explicit Xoshiro256PlusPlus(std::seed_seq& seed_sequence)
+        : state_(detail::generate_words<4>(seed_sequence)) {
+        if (state_ == std::array<uint64_t, 4>{}) state_[0] = 1;  // All zero state is a fixed point
+    }
+
+    /**
+     * @brief Smallest value the generator produces
+     */
+    [[nodiscard]] static constexpr auto min() { return result_type(0); }
+
+    /**
+     * @brief Largest value the generator produces
+     */
+    [[nodiscard]] static constexpr auto max() { return UINT64_MAX; }
+
+    /**
+     * @brief Generate the next value
+     */
+    constexpr auto operator()() -> result_type {
+        auto& s = state_;
+        auto const result = detail::rotl(s[0] + s[3], 23) + s[0];
+        auto const t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = detail::rotl(s[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Advance the state by 2^128 steps, equivalent to that many calls to operator()
+     *
+     * Generators jumped a different number of times from the same seed produce non-overlapping
+     * sequences, which makes them suitable for independent parallel streams.
+     */
+    constexpr void jump() {
+        apply_jump(
+            {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c});
+    }
+
+    /**
+     * @brief Advance the state by 2^192 steps, equivalent to 2^64 calls to jump()
+     */
+    constexpr void long_jump() {
+        apply_jump(
+            {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635});
+    }
+
+   private:
+    constexpr void apply_jump(std::array<uint64_t, 4> const& polynomial) {
+        auto jumped = std::array<uint64_t, 4>{};
+        for (auto const word : polynomial) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if ((word >> bit) & 1) {
+                    for (size_t i = 0; i < jumped.size(); ++i) jumped[i] ^= state_[i];
+                }
+                (*this)();
+            }
+        }
+        state_ = jumped;
+    }
+};
+
+/**
+ * @brief PCG64 random number generator
+ *
+ * The 128 bit state, 64 bit output XSL RR variant of the permuted congruential generator, as in
+ * the reference pcg64 and numpy's PCG64. From "PCG: A Family of Simple Fast Space-Efficient
+ * Statistically Good Algorithms for Random Number Generation", O'Neill, 2014.
+ */
+class Pcg64 {
+    static constexpr auto multiplier_hi = uint64_t(0x2360ed051fc65da4);
+    static constexpr auto multiplier_lo = uint64_t(0x4385df649fccf645);
+
+    uint64_t state_hi_{};
+    uint64_t state_lo_{};
+    uint64_t increment_hi_{};
+    uint64_t increment_lo_{};
+
+   public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Construct from a 64 bit seed on the default stream
+     */
+    explicit Pcg64(uint64_t seed = 0) : Pcg64(0, seed, 0x5851f42d4c957f2d, 0x14057b7ef767814f) {}
+
+    /**
+     * @brief Construct from a seed sequence, which selects both the state and the stream
+     */
+    explicit Pcg64(std::seed_seq& seed_sequence)
+        : Pcg64(detail::generate_words<4>(seed_sequence)) {}
+
+    /**
+     * @brief Construct from a 128 bit initial state and a 128 bit stream selector, matching
+     * pcg_setseq_128_srandom_r from the reference implementation
+     */
+    Pcg64(uint64_t state_hi, uint64_t state_lo, uint64_t stream_hi, uint64_t stream_lo)
+        : increment_hi_((stream_hi << 1) | (stream_lo >> 63)), increment_lo_((stream_lo << 1) | 1) {
+        step();
+        add(state_lo_, state_hi_, state_lo, state_hi);
+        step();
+    }
+
+    /**
+     * @brief Smallest value the generator produces
+     */
+    [[nodiscard]] static constexpr auto min() { return result_type(0); }
+
+    /**
+     * @brief Largest value the generator produces
+     */
+    [[nodiscard]] static constexpr auto max() { return UINT64_MAX; }
+
+    /**
+     * @brief Generate the next value
+     */
+    auto operator()() -> result_type {
+        step();
+        return detail::rotr(state_hi_ ^ state_lo_, int(state_hi_ >> 58));
+    }
+
+   private:
+    explicit Pcg64(std::array<uint64_t, 4> const& words)
+        : Pcg64(words[0], words[1], words[2], words[3]) {}
+
+    static void add(uint64_t& lo, uint64_t& hi, uint64_t rhs_lo, uint64_t rhs_hi) {
+        lo += rhs_lo;
+        hi += rhs_hi + (lo < rhs_lo ? 1 : 0);
+    }
+
+    void step() {
+        auto hi = detail::mulhi(state_lo_, multiplier_lo) + state_lo_ * multiplier_hi +
+                  state_hi_ * multiplier_lo;
+        auto lo = state_lo_ * multiplier_lo;
+        add(lo, hi, increment_lo_, increment_hi_);
+        state_hi_ = hi;
+        state_lo_ = lo;
+    }
+};
+
+/**
+ * @brief Number of xoshiro256++ streams of a seed that are created with jump() or long_jump(), and
+ * so are guaranteed not to overlap. Each costs up to this many jumps to create. Streams with higher
+ * indices are seeded from a seed sequence of the seed and the stream index in O(1), so they are
+ * independent with overwhelming probability rather than by construction.
+ */
+constexpr inline uint64_t xoshiro_jump_stream_count = 64;
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+template <typename Engine>
+struct EngineTag {};
+
+// Seeds a thread's generator from a seed sequence, an explicit stream of the global seed, or
+// otherwise either an automatic stream of the global seed or the random device
+RSL_EXPORT auto thread_engine(EngineTag<std::mt19937>, std::seed_seq& seed_sequence,
+                              std::optional<uint64_t> stream) -> std::mt19937&;
+RSL_EXPORT auto thread_engine(EngineTag<SplitMix64>, std::seed_seq& seed_sequence,
+                              std::optional<uint64_t> stream) -> SplitMix64&;
+RSL_EXPORT auto thread_engine(EngineTag<Xoshiro256PlusPlus>, std::seed_seq& seed_sequence,
+                              std::optional<uint64_t> stream) -> Xoshiro256PlusPlus&;
+RSL_EXPORT auto thread_engine(EngineTag<Pcg64>, std::seed_seq& seed_sequence,
+                              std::optional<uint64_t> stream) -> Pcg64&;
+
+// Explicit and automatic streams are disjoint: xoshiro256++ uses jump() for explicit streams and
+// long_jump() for automatic ones, PCG64 uses a different stream selector and other engines mix the
+// kind into their seed sequence. Xoshiro256++ streams past xoshiro_jump_stream_count are seeded
+// like other engines, so creating any stream is O(1).
+template <typename Engine>
+[[nodiscard]] auto make_stream_engine(uint64_t seed, uint64_t stream, bool automatic) -> Engine {
+    if constexpr (std::is_same_v<Engine, Xoshiro256PlusPlus>) {
+        if (stream < xoshiro_jump_stream_count) {
+            auto engine = Engine(seed);
+            for (uint64_t i = 0; i < stream + (automatic ? 1 : 0); ++i) {
+                if (automatic)
+                    engine.long_jump();
+                else
+                    engine.jump();
+            }
+            return engine;
+        }
+    }
+    if constexpr (std::is_same_v<Engine, Pcg64>) {
+        return Pcg64(0, seed, automatic ? 1 : 0, stream);
+    } else {
+        auto sequence = std::seed_seq{uint32_t(seed), uint32_t(seed >> 32), uint32_t(stream),
+                                      uint32_t(stream >> 32), uint32_t(automatic)};
+        return Engine(sequence);
+    }
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
 /**
  * @brief Get a random number generator
  *
@@ -20,27 +336,124 @@ namespace rsl {
  * sequence is provided this function throws. The returned value is a reference to a thread_local
  * static generator.
  *
+ * Each engine type has its own generator per thread. The generators live in the rsl library, so
+ * seeding from application code also determines the numbers drawn inside rsl.
+ *
  * @param seed_sequence Seed sequence for random number generator
  *
+ * @tparam Engine One of std::mt19937, rsl::SplitMix64, rsl::Xoshiro256PlusPlus or rsl::Pcg64
+ *
+ * @return Seeded random number generator
+ */
+template <typename Engine = std::mt19937>
+auto rng(std::seed_seq seed_sequence) -> Engine& {
+    return detail::thread_engine(detail::EngineTag<Engine>(), seed_sequence, std::nullopt);
+}
+
+/**
+ * @brief Make every thread's random number generator deterministic. Example usage:
+ *
+ * @code
+ * rsl::set_global_seed(42);
+ * for (size_t worker = 0; worker < 8; ++worker) {
+ *     threads.emplace_back([worker] {
+ *         auto& rng = rsl::rng_stream<rsl::Xoshiro256PlusPlus>(worker);
+ *         // ...
+ *     });
+ * }
+ * @endcode
+ *
+ * Generators created after this call are seeded from the global seed instead of the random device,
+ * which also makes starting a thread cheap. Threads that call rsl::rng_stream get the stream with
+ * that index, so results do not depend on thread scheduling. Other threads get automatic streams
+ * numbered in the order they first call rsl::rng, which is only reproducible if that order is.
+ * Explicit and automatic streams never coincide. Any stream index is cheap to create, see
+ * rsl::xoshiro_jump_stream_count for how xoshiro256++ streams are derived.
+ *
+ * Generators already created keep their state, so call this before starting worker threads.
+ *
+ * @param seed Global seed
+ */
+RSL_EXPORT void set_global_seed(uint64_t seed);
+
+/**
+ * @brief Undo rsl::set_global_seed, so generators created afterwards are seeded from the random
+ * device again and rsl::rng_stream throws
+ *
+ * Generators already created keep their state.
+ */
+RSL_EXPORT void clear_global_seed();
+
+/**
+ * @brief Seed this thread's random number generator with a stream of the global seed
+ *
+ * Throws if rsl::set_global_seed has not been called or if this thread's generator already exists.
+ *
+ * @param stream Stream index, e.g. the index of a worker thread
+ *
+ * @tparam Engine One of std::mt19937, rsl::SplitMix64, rsl::Xoshiro256PlusPlus or rsl::Pcg64
+ *
+ * @return Seeded random number generator
+ */
+template <typename Engine = std::mt19937>
+auto rng_stream(uint64_t stream) -> Engine& {
+    auto empty = std::seed_seq();
+    return detail::thread_engine(detail::EngineTag<Engine>(), empty, stream);
+}
+
+/**
+ * @brief Make a random number generator for one stream of a seed, independent of thread-local state
+ *
+ * The first rsl::xoshiro_jump_stream_count streams of xoshiro256++ are 2^128 steps apart and cost
+ * one jump() per stream index to create, later ones are seeded like other engines. Streams of PCG64
+ * use the stream selector. Other engines derive each stream's seed sequence from
+ * the seed and the stream index.
+ *
+ * @param seed Seed shared by all streams
+ * @param stream Stream index
+ *
+ * @tparam Engine One of std::mt19937, rsl::SplitMix64, rsl::Xoshiro256PlusPlus or rsl::Pcg64
+ *
+ * @return Random number generator
+ */
+template <typename Engine = std::mt19937>
+[[nodiscard]] auto make_stream_engine(uint64_t seed, uint64_t stream) -> Engine {
+    return detail::make_stream_engine<Engine>(seed, stream, false);
+}
+
+/**
+ * @brief Get this thread's random number generator, seeding it from the random device if this is
+ * the first call
+ *
+ * The reference is cached inline on each thread, so after the first call this costs a thread_local
+ * access rather than a call into the library.
+ *
+ * @tparam Engine One of std::mt19937, rsl::SplitMix64, rsl::Xoshiro256PlusPlus or rsl::Pcg64
+ *
  * @return Seeded random number generator
  */
-RSL_EXPORT auto rng(std::seed_seq seed_sequence = {}) -> std::mt19937&;
+template <typename Engine = std::mt19937>
+[[nodiscard]] auto rng() -> Engine& {
+    thread_local auto* const engine = &rng<Engine>(std::seed_seq());
+    return *engine;
+}
 
 /**
  * @brief Get a uniform real number in a given range
  *
  * @param lower Lower bound, inclusive
  * @param upper Upper bound, exclusive
+ * @param engine Random number generator, defaults to this thread's rsl::rng()
  *
  * @tparam RealType Floating point type
  *
  * @return Uniform real in range [lower, upper)
  */
-template <typename RealType>
-[[nodiscard]] auto uniform_real(RealType lower, RealType upper) {
+template <typename RealType, typename Engine = std::mt19937>
+[[nodiscard]] auto uniform_real(RealType lower, RealType upper, Engine& engine = rng<Engine>()) {
     static_assert(std::is_floating_point_v<RealType>, "RealType must be a floating point type");
     assert(lower < upper && "rsl::uniform_real: Lower bound be less than upper bound");
-    return std::uniform_real_distribution(lower, upper)(rng());
+    return std::uniform_real_distribution(lower, upper)(engine);
 }
 
 /**
@@ -48,23 +461,412 @@ template <typename RealType>
  *
  * @param lower Lower bound, inclusive
  * @param upper Upper bound, inclusive
+ * @param engine Random number generator, defaults to this thread's rsl::rng()
  *
  * @tparam IntType Integral type
  *
  * @return Uniform integer in range [lower, upper]
  */
-template <typename IntType>
-[[nodiscard]] auto uniform_int(IntType lower, IntType upper) {
+template <typename IntType, typename Engine = std::mt19937>
+[[nodiscard]] auto uniform_int(IntType lower, IntType upper, Engine& engine = rng<Engine>()) {
     static_assert(std::is_integral_v<IntType>, "IntType must be an integral type");
     assert(lower <= upper &&
            "rsl::uniform_int: Lower bound must be less than or equal to upper bound");
-    return std::uniform_int_distribution(lower, upper)(rng());
+    return std::uniform_int_distribution(lower, upper)(engine);
+}
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+template <typename Engine>
+constexpr bool is_64_bit_engine_v = Engine::min() == 0 && Engine::max() == UINT64_MAX;
+
+// Uniform in [0, 1) from the high bits of a 64 bit value, without branches or rejection
+template <typename T>
+[[nodiscard]] constexpr auto to_unit_interval(uint64_t bits) -> T {
+    if constexpr (std::is_same_v<T, float>)
+        return float(bits >> 40) * 0x1.0p-24F;
+    else
+        return T(bits >> 11) * T(0x1.0p-53);
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Fill a span with uniform real numbers in a given range. Example usage:
+ *
+ * @code
+ * auto samples = std::vector<double>(1'000'000);
+ * rsl::fill_uniform_real(tcb::span(samples), -1., 1.);
+ * @endcode
+ *
+ * Each number is converted from the top bits of one 64 bit draw with a multiply, so the loop has
+ * no branches and runs much faster than repeated calls to rsl::uniform_real.
+ *
+ * @param values Span to fill
+ * @param lower Lower bound, inclusive
+ * @param upper Upper bound, exclusive
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ */
+template <typename T, size_t extent, typename Engine = Xoshiro256PlusPlus>
+void fill_uniform_real(tcb::span<T, extent> values, std::remove_cv_t<T> lower,
+                       std::remove_cv_t<T> upper, Engine& engine = rng<Engine>()) {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    static_assert(detail::is_64_bit_engine_v<Engine>, "Engine must produce 64 bit values");
+    assert(lower < upper && "rsl::fill_uniform_real: Lower bound must be less than upper bound");
+    auto const scale = upper - lower;
+    auto const largest = std::nextafter(upper, lower);  // Rounding may otherwise reach upper
+    for (auto& value : values)
+        value = std::min(lower + detail::to_unit_interval<T>(engine()) * scale, largest);
+}
+
+/**
+ * @brief Fill a span with uniform integers in a given range
+ *
+ * Uses Lemire's nearly divisionless method, which needs one multiply per number and only rarely
+ * draws again to avoid bias.
+ *
+ * @param values Span to fill
+ * @param lower Lower bound, inclusive
+ * @param upper Upper bound, inclusive
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ */
+template <typename T, size_t extent, typename Engine = Xoshiro256PlusPlus>
+void fill_uniform_int(tcb::span<T, extent> values, std::remove_cv_t<T> lower,
+                      std::remove_cv_t<T> upper, Engine& engine = rng<Engine>()) {
+    static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t),
+                  "T must be an integral type of at most 64 bits");
+    static_assert(detail::is_64_bit_engine_v<Engine>, "Engine must produce 64 bit values");
+    assert(lower <= upper &&
+           "rsl::fill_uniform_int: Lower bound must be less than or equal to upper bound");
+    auto const offset = uint64_t(lower);
+    auto const range = uint64_t(upper) - offset + 1;  // Zero if all 64 bit values are in range
+    if (range == 0) {
+        for (auto& value : values) value = T(engine());
+        return;
+    }
+
+    auto const threshold = (0 - range) % range;
+    for (auto& value : values) {
+        auto bits = engine();
+        while (bits * range < threshold) bits = engine();
+        value = T(offset + detail::mulhi(bits, range));
+    }
+}
+
+/**
+ * @brief Fill a span with normally distributed real numbers
+ *
+ * Uses the Box-Muller transform on pairs of uniform numbers. The uniform numbers are drawn in one
+ * pass and transformed in a second pass without branches so the math can be vectorized.
+ *
+ * @param values Span to fill
+ * @param mean Mean of the distribution
+ * @param stddev Standard deviation of the distribution
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ */
+template <typename T, size_t extent, typename Engine = Xoshiro256PlusPlus>
+void fill_normal(tcb::span<T, extent> values, std::remove_cv_t<T> mean, std::remove_cv_t<T> stddev,
+                 Engine& engine = rng<Engine>()) {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    static_assert(detail::is_64_bit_engine_v<Engine>, "Engine must produce 64 bit values");
+    assert(stddev >= 0 && "rsl::fill_normal: Standard deviation must not be negative");
+    using Real = std::remove_cv_t<T>;
+    constexpr auto two_pi = Real(6.283185307179586477);
+
+    // The first of each pair is in (0, 1] so its logarithm is finite
+    auto const size = values.size();
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        values[i] = Real(1) - detail::to_unit_interval<Real>(engine());
+        values[i + 1] = detail::to_unit_interval<Real>(engine());
+    }
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        auto const radius = stddev * std::sqrt(Real(-2) * std::log(values[i]));
+        auto const angle = two_pi * values[i + 1];
+        values[i] = mean + radius * std::cos(angle);
+        values[i + 1] = mean + radius * std::sin(angle);
+    }
+    if (size % 2 != 0) {
+        auto const u1 = Real(1) - detail::to_unit_interval<Real>(engine());
+        auto const u2 = detail::to_unit_interval<Real>(engine());
+        auto const radius = stddev * std::sqrt(Real(-2) * std::log(u1));
+        values[size - 1] = mean + radius * std::cos(two_pi * u2);
+    }
+}
+
+/**
+ * @brief Fill an Eigen matrix or array with uniform real numbers in a given range
+ * @see rsl::fill_uniform_real(tcb::span<T, extent>, ...)
+ */
+template <typename Derived, typename Engine = Xoshiro256PlusPlus>
+void fill_uniform_real(Eigen::PlainObjectBase<Derived>& matrix, typename Derived::Scalar lower,
+                       typename Derived::Scalar upper, Engine& engine = rng<Engine>()) {
+    using Scalar = typename Derived::Scalar;
+    fill_uniform_real(tcb::span<Scalar>(matrix.data(), size_t(matrix.size())), lower, upper,
+                      engine);
+}
+
+/**
+ * @brief Fill an Eigen matrix or array with uniform integers in a given range
+ * @see rsl::fill_uniform_int(tcb::span<T, extent>, ...)
+ */
+template <typename Derived, typename Engine = Xoshiro256PlusPlus>
+void fill_uniform_int(Eigen::PlainObjectBase<Derived>& matrix, typename Derived::Scalar lower,
+                      typename Derived::Scalar upper, Engine& engine = rng<Engine>()) {
+    using Scalar = typename Derived::Scalar;
+    fill_uniform_int(tcb::span<Scalar>(matrix.data(), size_t(matrix.size())), lower, upper,
+                     engine);
+}
+
+/**
+ * @brief Fill an Eigen matrix or array with normally distributed real numbers
+ * @see rsl::fill_normal(tcb::span<T, extent>, ...)
+ */
+template <typename Derived, typename Engine = Xoshiro256PlusPlus>
+void fill_normal(Eigen::PlainObjectBase<Derived>& matrix, typename Derived::Scalar mean,
+                 typename Derived::Scalar stddev, Engine& engine = rng<Engine>()) {
+    using Scalar = typename Derived::Scalar;
+    fill_normal(tcb::span<Scalar>(matrix.data(), size_t(matrix.size())), mean, stddev, engine);
+}
+
+/**
+ * @brief Sample configurations uniformly from a box. Example usage:
+ *
+ * @code
+ * auto const configurations = rsl::sample_box(joint_lower_limits, joint_upper_limits, 100'000);
+ * for (auto const& configuration : configurations.colwise()) try_configuration(configuration);
+ * @endcode
+ *
+ * Draws all numbers with rsl::fill_uniform_real and scales them with whole matrix operations,
+ * rather than a call to rsl::uniform_real per coordinate.
+ *
+ * @param lower Lower bound of each dimension, inclusive
+ * @param upper Upper bound of each dimension
+ * @param count Number of samples
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ *
+ * @return dimensions x count matrix with one sample per column
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto sample_box(Eigen::VectorXd const& lower, Eigen::VectorXd const& upper,
+                              size_t count, Engine& engine = rng<Engine>()) -> Eigen::MatrixXd {
+    assert(lower.size() == upper.size() && "rsl::sample_box: Bounds must have the same size");
+    assert((lower.array() <= upper.array()).all() &&
+           "rsl::sample_box: Lower bounds must not exceed upper bounds");
+    auto samples = Eigen::MatrixXd(lower.size(), Eigen::Index(count));
+    fill_uniform_real(samples, 0., 1., engine);
+    samples.array().colwise() *= (upper - lower).array();
+    samples.colwise() += lower;
+    return samples;
+}
+
+/**
+ * @brief Sample configurations from a normal distribution around a configuration. Example usage:
+ *
+ * @code
+ * auto const nearby = rsl::sample_gaussian_around(current_configuration, stddevs, 1000);
+ * @endcode
+ *
+ * @param center Mean of the samples
+ * @param stddev Standard deviation of each dimension
+ * @param count Number of samples
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ *
+ * @return dimensions x count matrix with one sample per column
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto sample_gaussian_around(Eigen::VectorXd const& center,
+                                          Eigen::VectorXd const& stddev, size_t count,
+                                          Engine& engine = rng<Engine>()) -> Eigen::MatrixXd {
+    assert(center.size() == stddev.size() &&
+           "rsl::sample_gaussian_around: Center and standard deviations must have the same size");
+    assert((stddev.array() >= 0).all() &&
+           "rsl::sample_gaussian_around: Standard deviations must not be negative");
+    auto samples = Eigen::MatrixXd(center.size(), Eigen::Index(count));
+    fill_normal(samples, 0., 1., engine);
+    samples.array().colwise() *= stddev.array();
+    samples.colwise() += center;
+    return samples;
+}
+
+/**
+ * @brief Sample configurations from a normal distribution around a configuration, clamped to
+ * limits
+ *
+ * Samples outside the limits are moved onto them rather than redrawn, so the distribution has mass
+ * on the limits.
+ *
+ * @param center Mean of the samples
+ * @param stddev Standard deviation of each dimension
+ * @param lower Lower limit of each dimension
+ * @param upper Upper limit of each dimension
+ * @param count Number of samples
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ *
+ * @return dimensions x count matrix with one sample per column
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto sample_gaussian_around(Eigen::VectorXd const& center,
+                                          Eigen::VectorXd const& stddev,
+                                          Eigen::VectorXd const& lower,
+                                          Eigen::VectorXd const& upper, size_t count,
+                                          Engine& engine = rng<Engine>()) -> Eigen::MatrixXd {
+    assert(lower.size() == center.size() && upper.size() == center.size() &&
+           "rsl::sample_gaussian_around: Limits must have the same size as the center");
+    assert((lower.array() <= upper.array()).all() &&
+           "rsl::sample_gaussian_around: Lower limits must not exceed upper limits");
+    auto samples = sample_gaussian_around(center, stddev, count, engine);
+    auto const columns = samples.cols();
+    samples = samples.cwiseMax(lower.replicate(1, columns)).cwiseMin(upper.replicate(1, columns));
+    return samples;
 }
 
 /**
  * @brief Generate a random unit quaternion of doubles
+ * @param engine Random number generator, defaults to this thread's rsl::rng()
  * @return Random unit quaternion
  */
-[[nodiscard]] RSL_EXPORT auto random_unit_quaternion() -> Eigen::Quaterniond;
+template <typename Engine = std::mt19937>
+[[nodiscard]] auto random_unit_quaternion(Engine& engine = rng<Engine>()) -> Eigen::Quaterniond {
+    // From "Uniform Random Rotations", Ken Shoemake, Graphics Gems III, pg. 124-132
+    constexpr auto two_pi = 6.283185307179586477;
+    auto const x0 = uniform_real(0., 1., engine);
+    auto const r1 = std::sqrt(1 - x0);
+    auto const r2 = std::sqrt(x0);
+    auto const t1 = uniform_real(0., two_pi, engine);
+    auto const t2 = uniform_real(0., two_pi, engine);
+    auto const x = r1 * std::sin(t1);
+    auto const y = r1 * std::cos(t1);
+    auto const z = r2 * std::sin(t2);
+    auto const w = r2 * std::cos(t2);
+    return Eigen::Quaterniond(w, x, y, z);  // Unit length by construction
+}
+
+/**
+ * @brief Generate uniformly distributed random unit quaternions
+ *
+ * Each column holds one quaternion in Eigen's (x, y, z, w) coefficient order, so it can be viewed
+ * with Eigen::Map<Eigen::Quaterniond>(quaternions.col(i).data()). The trigonometry is evaluated
+ * with Eigen array expressions over all samples at once, which Eigen vectorizes.
+ *
+ * @param count Number of quaternions
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ *
+ * @return 4 x count matrix of unit quaternions
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto random_unit_quaternions(size_t count, Engine& engine = rng<Engine>())
+    -> Eigen::Matrix4Xd {
+    constexpr auto two_pi = 6.283185307179586477;
+    auto const size = Eigen::Index(count);
+
+    // Same construction as random_unit_quaternion, one contiguous column per variable
+    auto uniform = Eigen::ArrayX3d(size, 3);
+    fill_uniform_real(uniform, 0., 1., engine);
+    auto const r1 = (1 - uniform.col(0)).sqrt().eval();
+    auto const r2 = uniform.col(0).sqrt().eval();
+    auto const t1 = (two_pi * uniform.col(1)).eval();
+    auto const t2 = (two_pi * uniform.col(2)).eval();
+
+    auto quaternions = Eigen::Matrix4Xd(4, size);
+    quaternions.row(0) = (r1 * t1.sin()).matrix().transpose();
+    quaternions.row(1) = (r1 * t1.cos()).matrix().transpose();
+    quaternions.row(2) = (r2 * t2.sin()).matrix().transpose();
+    quaternions.row(3) = (r2 * t2.cos()).matrix().transpose();
+    return quaternions;
+}
+
+/**
+ * @brief Generate uniformly distributed random rotation matrices
+ * @param count Number of rotation matrices
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ * @return Random rotation matrices
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto random_rotation_matrices(size_t count, Engine& engine = rng<Engine>())
+    -> std::vector<Eigen::Matrix3d> {
+    auto const quaternions = random_unit_quaternions(count, engine);
+    auto rotations = std::vector<Eigen::Matrix3d>();
+    rotations.reserve(count);
+    for (Eigen::Index i = 0; i < quaternions.cols(); ++i)
+        rotations.push_back(
+            Eigen::Map<Eigen::Quaterniond const>(quaternions.col(i).data()).toRotationMatrix());
+    return rotations;
+}
+
+/**
+ * @brief Generate random orientations near a given orientation
+ * @see rsl::random_perturbation(Eigen::Quaterniond const&, double, Engine&)
+ * @param orientation Orientation to perturb
+ * @param stddev Standard deviation of each rotation vector component, in radians
+ * @param count Number of orientations
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ * @return 4 x count matrix of unit quaternions in Eigen's (x, y, z, w) coefficient order
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto random_perturbations(Eigen::Quaterniond const& orientation, double stddev,
+                                        size_t count, Engine& engine = rng<Engine>())
+    -> Eigen::Matrix4Xd {
+    assert(stddev >= 0 && "rsl::random_perturbations: Standard deviation must not be negative");
+    auto const size = Eigen::Index(count);
+
+    // Exponential map of normally distributed rotation vectors, one contiguous column per axis
+    auto rotation_vectors = Eigen::ArrayX3d(size, 3);
+    fill_normal(rotation_vectors, 0., stddev, engine);
+    auto const angles = rotation_vectors.square().rowwise().sum().sqrt().eval();
+    auto const half_angles = (angles / 2).eval();
+
+    // sin(angle / 2) / angle tends to one half as the angle goes to zero
+    auto const scale = (angles > 1e-12).select(half_angles.sin() / angles, 0.5).eval();
+
+    auto perturbations = Eigen::Matrix4Xd(4, size);
+    for (Eigen::Index axis = 0; axis < 3; ++axis)
+        perturbations.row(axis) = (scale * rotation_vectors.col(axis)).matrix().transpose();
+    perturbations.row(3) = half_angles.cos().matrix().transpose();
+
+    for (Eigen::Index i = 0; i < size; ++i) {
+        auto perturbation = Eigen::Map<Eigen::Quaterniond>(perturbations.col(i).data());
+        perturbation = orientation * perturbation;
+    }
+    return perturbations;
+}
+
+/**
+ * @brief Generate a random orientation near a given orientation. Example usage:
+ *
+ * @code
+ * auto const grasp = rsl::random_perturbation(nominal_grasp, 0.05); // About 3 degrees
+ * @endcode
+ *
+ * The perturbation is a rotation vector with independent normally distributed components, applied
+ * in the frame of the given orientation. The angle from the given orientation follows a chi
+ * distribution with three degrees of freedom scaled by stddev, so samples concentrate in a cone
+ * without rejection sampling.
+ *
+ * @param orientation Orientation to perturb
+ * @param stddev Standard deviation of each rotation vector component, in radians
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ *
+ * @return Perturbed orientation
+ */
+template <typename Engine = Xoshiro256PlusPlus>
+[[nodiscard]] auto random_perturbation(Eigen::Quaterniond const& orientation, double stddev,
+                                       Engine& engine = rng<Engine>()) -> Eigen::Quaterniond {
+    auto const perturbations = random_perturbations(orientation, stddev, 1, engine);
+    return Eigen::Quaterniond(Eigen::Map<Eigen::Quaterniond const>(perturbations.data()));
+}
 
 }  // namespace rsl
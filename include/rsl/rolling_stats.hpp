@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+// Fixed capacity double-ended queue of sample sequence numbers
+template <size_t capacity>
+class SequenceDeque {
+    std::array<uint64_t, capacity> data_{};
+    size_t begin_{};
+    size_t size_{};
+
+   public:
+    [[nodiscard]] auto empty() const { return size_ == 0; }
+    [[nodiscard]] auto front() const { return data_[begin_]; }
+    [[nodiscard]] auto back() const { return data_[(begin_ + size_ - 1) % capacity]; }
+    void push_back(uint64_t value) { data_[(begin_ + size_++) % capacity] = value; }
+    void pop_back() { --size_; }
+    void pop_front() {
+        begin_ = (begin_ + 1) % capacity;
+        --size_;
+    }
+    void clear() { size_ = 0; }
+};
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Statistics over the most recent samples of a stream. Example usage:
+ *
+ * @code
+ * auto loop_times = rsl::RollingStats<double, 1000>();
+ * loop_times.push(elapsed);
+ * loop_times.mean();
+ * loop_times.max();
+ * loop_times.percentile(0.99);
+ * @endcode
+ *
+ * Samples are kept in a fixed capacity ring buffer, so pushing never allocates. Mean and variance
+ * are updated in O(1) with Welford's algorithm, adding the new sample and removing the one that
+ * leaves the window. Minimum and maximum are maintained in O(1) amortized with monotonic queues.
+ *
+ * @tparam T Floating point sample type
+ * @tparam window Number of most recent samples the statistics cover
+ */
+template <typename T, size_t window>
+class RollingStats {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+    static_assert(window > 0, "window must be greater than zero");
+
+    std::array<T, window> samples_{};
+    uint64_t count_{};  // Total samples pushed; the newest sample is at (count_ - 1) % window
+    T mean_{};
+    T m2_{};  // Sum of squared differences from the mean
+    detail::SequenceDeque<window> min_queue_;
+    detail::SequenceDeque<window> max_queue_;
+
+   public:
+    /**
+     * @brief Add a sample, evicting the oldest one if the window is full
+     */
+    void push(T sample) {
+        auto& slot = samples_[count_ % window];
+        if (count_ < window) {
+            auto const delta = sample - mean_;
+            mean_ += delta / T(count_ + 1);
+            m2_ += delta * (sample - mean_);
+        } else {
+            auto const evicted = slot;
+            auto const previous_mean = mean_;
+            mean_ += (sample - evicted) / T(window);
+            m2_ += (sample - evicted) * (sample - mean_ + evicted - previous_mean);
+            m2_ = std::max(m2_, T(0));  // Guard against rounding below zero
+        }
+        slot = sample;
+
+        auto const sequence = count_++;
+        // Evict the sample that left the window first, so the queues never exceed their capacity
+        // and its slot, which now holds the new sample, is never compared against
+        auto const expired = [this](uint64_t seq) { return seq + window < count_; };
+        if (!min_queue_.empty() && expired(min_queue_.front())) min_queue_.pop_front();
+        if (!max_queue_.empty() && expired(max_queue_.front())) max_queue_.pop_front();
+        while (!min_queue_.empty() && sample_at(min_queue_.back()) >= sample) min_queue_.pop_back();
+        while (!max_queue_.empty() && sample_at(max_queue_.back()) <= sample) max_queue_.pop_back();
+        min_queue_.push_back(sequence);
+        max_queue_.push_back(sequence);
+    }
+
+    /**
+     * @brief Remove all samples
+     */
+    void clear() {
+        count_ = 0;
+        mean_ = T(0);
+        m2_ = T(0);
+        min_queue_.clear();
+        max_queue_.clear();
+    }
+
+    /**
+     * @brief Get the number of samples in the window
+     */
+    [[nodiscard]] auto size() const { return size_t(std::min(count_, uint64_t(window))); }
+
+    /**
+     * @brief Check if no samples have been pushed
+     */
+    [[nodiscard]] auto empty() const { return count_ == 0; }
+
+    /**
+     * @brief Get the mean of the samples in the window
+     */
+    [[nodiscard]] auto mean() const { return mean_; }
+
+    /**
+     * @brief Get the sample variance of the samples in the window, zero if there are fewer than two
+     */
+    [[nodiscard]] auto variance() const { return size() < 2 ? T(0) : m2_ / T(size() - 1); }
+
+    /**
+     * @brief Get the sample standard deviation of the samples in the window
+     */
+    [[nodiscard]] auto stddev() const { return std::sqrt(variance()); }
+
+    /**
+     * @brief Get the smallest sample in the window
+     * @pre At least one sample has been pushed
+     */
+    [[nodiscard]] auto min() const {
+        assert(!empty() && "rsl::RollingStats::min: No samples");
+        return sample_at(min_queue_.front());
+    }
+
+    /**
+     * @brief Get the largest sample in the window
+     * @pre At least one sample has been pushed
+     */
+    [[nodiscard]] auto max() const {
+        assert(!empty() && "rsl::RollingStats::max: No samples");
+        return sample_at(max_queue_.front());
+    }
+
+    /**
+     * @brief Get a percentile of the samples in the window using the nearest rank method
+     *
+     * This is exact and does not allocate, but is O(window) per call since a windowed percentile
+     * cannot be updated incrementally. Use rsl::P2Quantile for a constant time approximation over
+     * a whole stream.
+     *
+     * @param fraction Percentile as a fraction in [0, 1], e.g. 0.99
+     * @pre At least one sample has been pushed
+     */
+    [[nodiscard]] auto percentile(double fraction) const {
+        assert(!empty() && "rsl::RollingStats::percentile: No samples");
+        assert(fraction >= 0. && fraction <= 1. &&
+               "rsl::RollingStats::percentile: Fraction must be in [0, 1]");
+        auto copy = samples_;
+        auto const end = copy.begin() + std::ptrdiff_t(size());
+        auto const rank = std::min(size_t(std::ceil(fraction * double(size()))), size());
+        auto const nth = copy.begin() + std::ptrdiff_t(rank == 0 ? 0 : rank - 1);
+        std::nth_element(copy.begin(), nth, end);
+        return *nth;
+    }
+
+   private:
+    [[nodiscard]] auto sample_at(uint64_t sequence) const { return samples_[sequence % window]; }
+};
+
+/**
+ * @brief Constant memory, constant time approximation of a quantile of a stream. Example usage:
+ *
+ * @code
+ * auto p99 = rsl::P2Quantile<double>(0.99);
+ * for (auto const sample : samples) p99.push(sample);
+ * p99.value();
+ * @endcode
+ *
+ * Implements the P² algorithm from "The P² Algorithm for Dynamic Calculation of Quantiles and
+ * Histograms Without Storing Observations", Jain and Chlamtac, 1985. Five markers are adjusted
+ * with piecewise-parabolic interpolation as samples arrive.
+ *
+ * @tparam T Floating point sample type
+ */
+template <typename T>
+class P2Quantile {
+    static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+
+    std::array<T, 5> heights_{};
+    std::array<double, 5> positions_{0., 1., 2., 3., 4.};
+    std::array<double, 5> desired_{};
+    std::array<double, 5> increments_{};
+    double quantile_;
+    uint64_t count_{};
+
+   public:
+    /**
+     * @brief Construct an estimator
+     * @param quantile Quantile to estimate as a fraction in [0, 1], e.g. 0.99
+     */
+    explicit P2Quantile(double quantile)
+        : desired_{0., 2. * quantile, 4. * quantile, 2. + 2. * quantile, 4.},
+          increments_{0., quantile / 2., quantile, (1. + quantile) / 2., 1.},
+          quantile_(quantile) {
+        assert(quantile >= 0. && quantile <= 1. &&
+               "rsl::P2Quantile::P2Quantile: Quantile must be in [0, 1]");
+    }
+
+    /**
+     * @brief Add a sample
+     */
+    void push(T sample) {
+        if (count_ < heights_.size()) {
+            heights_[count_++] = sample;
+            std::sort(heights_.begin(), heights_.begin() + std::ptrdiff_t(count_));
+            return;
+        }
+        ++count_;
+
+        // Find the cell containing the sample, widening the extreme markers if needed
+        auto cell = size_t(0);
+        if (sample < heights_[0]) {
+            heights_[0] = sample;
+        } else if (sample >= heights_[4]) {
+            heights_[4] = sample;
+            cell = 3;
+        } else {
+            while (sample >= heights_[cell + 1]) ++cell;
+        }
+
+        for (auto i = cell + 1; i < 5; ++i) positions_[i] += 1.;
+        for (size_t i = 0; i < 5; ++i) desired_[i] += increments_[i];
+
+        for (size_t i = 1; i < 4; ++i) {
+            auto const offset = desired_[i] - positions_[i];
+            if ((offset >= 1. && positions_[i + 1] - positions_[i] > 1.) ||
+                (offset <= -1. && positions_[i - 1] - positions_[i] < -1.)) {
+                auto const direction = offset > 0. ? 1. : -1.;
+                auto const height = parabolic(i, direction);
+                heights_[i] = heights_[i - 1] < height && height < heights_[i + 1]
+                                  ? height
+                                  : linear(i, direction);
+                positions_[i] += direction;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the current estimate, exact while fewer than five samples have been pushed
+     * @pre At least one sample has been pushed
+     */
+    [[nodiscard]] auto value() const {
+        assert(count_ > 0 && "rsl::P2Quantile::value: No samples");
+        if (count_ >= heights_.size()) return heights_[2];
+        auto const rank = std::min(size_t(std::ceil(quantile_ * double(count_))), size_t(count_));
+        return heights_[rank == 0 ? 0 : rank - 1];
+    }
+
+    /**
+     * @brief Get the number of samples pushed
+     */
+    [[nodiscard]] auto count() const { return count_; }
+
+   private:
+    [[nodiscard]] auto parabolic(size_t i, double direction) const {
+        auto const& q = heights_;
+        auto const& n = positions_;
+        return T(double(q[i]) +
+                 direction / (n[i + 1] - n[i - 1]) *
+                     ((n[i] - n[i - 1] + direction) * double(q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                      (n[i + 1] - n[i] - direction) * double(q[i] - q[i - 1]) / (n[i] - n[i - 1])));
+    }
+
+    [[nodiscard]] auto linear(size_t i, double direction) const {
+        auto const j = direction > 0. ? i + 1 : i - 1;
+        return T(double(heights_[i]) +
+                 direction * double(heights_[j] - heights_[i]) / (positions_[j] - positions_[i]));
+    }
+};
+
+}  // namespace rsl
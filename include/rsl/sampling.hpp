@@ -0,0 +1,266 @@
+#pragma once
+
+#include <rsl/random.hpp>
+
+#include <tcb_span/span.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+// Uniform in [0, range) with Lemire's method
+template <typename Engine>
+[[nodiscard]] auto uniform_index(uint64_t range, Engine& engine) -> uint64_t {
+    auto const threshold = (0 - range) % range;
+    auto bits = engine();
+    while (bits * range < threshold) bits = engine();
+    return detail::mulhi(bits, range);
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Table for drawing indices in proportion to fixed weights in constant time. Example usage:
+ *
+ * @code
+ * auto const table = rsl::AliasTable(tcb::span(particle_weights));
+ * auto const index = table.sample();
+ * table.sample(tcb::span(resampled_indices)); // Fills the span, without allocating
+ * @endcode
+ *
+ * Built with Vose's alias method in O(n). Each column holds a threshold and an alias, and a draw
+ * picks a column and either keeps it or takes its alias. One 64 bit draw supplies both: the high
+ * half of its product with the size picks the column and the low half is compared with the
+ * threshold. The bias of picking a column this way is below size / 2^64.
+ */
+class AliasTable {
+    struct Column {
+        uint64_t threshold;  // Keep the column if the fraction is below this
+        size_t alias;
+    };
+
+    std::vector<Column> columns_;
+
+   public:
+    /**
+     * @brief Construct a table
+     * @param weights Non-negative weights, not necessarily normalized, with a positive sum
+     */
+    template <typename T, size_t extent>
+    explicit AliasTable(tcb::span<T, extent> weights) : columns_(weights.size()) {
+        static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+        auto const size = weights.size();
+        auto const total = std::accumulate(weights.begin(), weights.end(), 0.);
+        assert(size > 0 && total > 0 &&
+               "rsl::AliasTable::AliasTable: Weights must have a positive sum");
+
+        auto scaled = std::vector<double>(size);
+        auto small = std::vector<size_t>();
+        auto large = std::vector<size_t>();
+        for (size_t i = 0; i < size; ++i) {
+            assert(weights[i] >= 0 && "rsl::AliasTable::AliasTable: Weights must not be negative");
+            scaled[i] = double(weights[i]) * double(size) / total;
+            (scaled[i] < 1. ? small : large).push_back(i);
+        }
+
+        while (!small.empty() && !large.empty()) {
+            auto const lesser = small.back();
+            auto const greater = large.back();
+            small.pop_back();
+            columns_[lesser] = {to_threshold(scaled[lesser]), greater};
+            scaled[greater] -= 1. - scaled[lesser];
+            if (scaled[greater] < 1.) {
+                large.pop_back();
+                small.push_back(greater);
+            }
+        }
+        // Whatever remains is full up to rounding
+        for (auto const i : large) columns_[i] = {UINT64_MAX, i};
+        for (auto const i : small) columns_[i] = {UINT64_MAX, i};
+    }
+
+    /**
+     * @brief Get the number of weights
+     */
+    [[nodiscard]] auto size() const { return columns_.size(); }
+
+    /**
+     * @brief Draw an index
+     * @param engine Random number generator producing 64 bit values, defaults to this thread's
+     * rsl::Xoshiro256PlusPlus
+     * @return Index in [0, size()) with probability proportional to its weight
+     */
+    template <typename Engine = Xoshiro256PlusPlus>
+    [[nodiscard]] auto sample(Engine& engine = rng<Engine>()) const -> size_t {
+        static_assert(detail::is_64_bit_engine_v<Engine>, "Engine must produce 64 bit values");
+        auto const bits = engine();
+        auto const& column = columns_[detail::mulhi(bits, columns_.size())];
+        auto const fraction = bits * columns_.size();
+        return fraction < column.threshold ? size_t(&column - columns_.data()) : column.alias;
+    }
+
+    /**
+     * @brief Fill a span with independently drawn indices
+     * @param indices Span to fill
+     * @param engine Random number generator producing 64 bit values, defaults to this thread's
+     * rsl::Xoshiro256PlusPlus
+     */
+    template <typename Index, size_t extent, typename Engine = Xoshiro256PlusPlus>
+    void sample(tcb::span<Index, extent> indices, Engine& engine = rng<Engine>()) const {
+        static_assert(std::is_integral_v<Index>, "Index must be an integral type");
+        for (auto& index : indices) index = Index(sample(engine));
+    }
+
+   private:
+    [[nodiscard]] static auto to_threshold(double probability) -> uint64_t {
+        return probability < 1. ? uint64_t(std::ldexp(probability, 64)) : UINT64_MAX;
+    }
+};
+
+/**
+ * @brief Resample indices in proportion to weights with systematic (low variance) resampling.
+ * Example usage:
+ *
+ * @code
+ * rsl::systematic_resample(tcb::span(particle_weights), tcb::span(resampled_indices));
+ * for (size_t i = 0; i < particles.size(); ++i)
+ *     next_particles[i] = particles[resampled_indices[i]];
+ * @endcode
+ *
+ * Places indices.size() evenly spaced points, with one random offset, on the cumulative weights and
+ * takes the index under each. This is O(n + m), needs a single random draw, and an index with
+ * expected count c is drawn either floor(c) or ceil(c) times, which gives less resampling noise
+ * than independent draws. Indices are written in increasing order.
+ *
+ * @param weights Non-negative weights, not necessarily normalized, with a positive sum
+ * @param indices Span to fill with the resampled indices
+ * @param engine Random number generator producing 64 bit values, defaults to this thread's
+ * rsl::Xoshiro256PlusPlus
+ */
+template <typename T, size_t extent, typename Index, size_t index_extent,
+          typename Engine = Xoshiro256PlusPlus>
+void systematic_resample(tcb::span<T, extent> weights, tcb::span<Index, index_extent> indices,
+                         Engine& engine = rng<Engine>()) {
+    static_assert(std::is_arithmetic_v<T>, "T must be an arithmetic type");
+    static_assert(std::is_integral_v<Index>, "Index must be an integral type");
+    static_assert(detail::is_64_bit_engine_v<Engine>, "Engine must produce 64 bit values");
+    auto const total = std::accumulate(weights.begin(), weights.end(), 0.);
+    assert(!weights.empty() && total > 0 &&
+           "rsl::systematic_resample: Weights must have a positive sum");
+    if (indices.empty()) return;
+
+    // Rounding can carry the last points past the total, so they stop at the last positive weight
+    auto last = weights.size() - 1;
+    while (weights[last] <= 0) --last;
+
+    auto const step = total / double(indices.size());
+    auto const offset = detail::to_unit_interval<double>(engine()) * step;
+    auto cumulative = double(weights[0]);
+    size_t i = 0;
+    for (size_t j = 0; j < indices.size(); ++j) {
+        auto const point = offset + double(j) * step;
+        while (i < last && cumulative <= point) cumulative += double(weights[++i]);
+        indices[j] = Index(i);
+    }
+}
+
+/**
+ * @brief Uniform random sample of fixed size from a stream of unknown length. Example usage:
+ *
+ * @code
+ * auto buffer = std::array<Measurement, 100>();
+ * auto reservoir = rsl::ReservoirSampler(tcb::span(buffer));
+ * for (auto const& measurement : stream) reservoir.push(measurement);
+ * use(reservoir.samples()); // Each measurement was kept with equal probability
+ * @endcode
+ *
+ * Samples are stored in a caller-provided span, so pushing never allocates. Uses Algorithm L from
+ * "Reservoir-Sampling Algorithms of Time Complexity O(n(1 + log(N/n)))", Kim-Hung Li, 1994, which
+ * draws how many items to skip rather than a random number per item, so most pushes are a compare.
+ *
+ * @tparam T Element type
+ * @tparam extent Extent of the reservoir span
+ * @tparam Engine Random number generator producing 64 bit values
+ */
+template <typename T, size_t extent = tcb::dynamic_extent, typename Engine = Xoshiro256PlusPlus>
+class ReservoirSampler {
+    static_assert(detail::is_64_bit_engine_v<Engine>, "Engine must produce 64 bit values");
+
+    tcb::span<T, extent> reservoir_;
+    Engine* engine_;
+    uint64_t count_{};  // Items pushed so far
+    uint64_t next_{};   // Index of the next item to store
+    double log_weight_{};
+
+   public:
+    /**
+     * @brief Construct an empty sampler
+     * @param reservoir Storage for the samples, its size is the sample size
+     * @param engine Random number generator, defaults to this thread's rsl::Xoshiro256PlusPlus
+     */
+    explicit ReservoirSampler(tcb::span<T, extent> reservoir, Engine& engine = rng<Engine>())
+        : reservoir_(reservoir), engine_(&engine) {
+        assert(!reservoir.empty() && "rsl::ReservoirSampler::ReservoirSampler: Empty reservoir");
+    }
+
+    /**
+     * @brief Offer an item from the stream
+     */
+    void push(T value) {
+        auto const capacity = reservoir_.size();
+        if (count_ < capacity) {
+            reservoir_[count_] = std::move(value);
+            if (++count_ == capacity) {
+                log_weight_ = log_uniform() / double(capacity);
+                skip();
+            }
+            return;
+        }
+        if (count_++ == next_) {
+            reservoir_[detail::uniform_index(capacity, *engine_)] = std::move(value);
+            log_weight_ += log_uniform() / double(capacity);
+            skip();
+        }
+    }
+
+    /**
+     * @brief Get the number of items pushed
+     */
+    [[nodiscard]] auto count() const { return count_; }
+
+    /**
+     * @brief Get the samples, all items if fewer than the reservoir size were pushed
+     */
+    [[nodiscard]] auto samples() const -> tcb::span<T> {
+        return {reservoir_.data(), size_t(std::min(count_, uint64_t(reservoir_.size())))};
+    }
+
+   private:
+    // Logarithm of a uniform number in (0, 1]
+    [[nodiscard]] auto log_uniform() -> double {
+        return std::log(1. - detail::to_unit_interval<double>((*engine_)()));
+    }
+
+    // Skip a geometrically distributed number of items with success probability exp(log_weight_)
+    void skip() {
+        auto const skipped = std::floor(log_uniform() / std::log1p(-std::exp(log_weight_)));
+        next_ = count_ + uint64_t(std::min(skipped, 0x1.0p62));
+    }
+};
+
+}  // namespace rsl
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @brief Trait for types that can be copied with std::memcpy. Defaults to
+ * std::is_trivially_copyable and may be specialized for types that are bitwise copyable in
+ * practice but declare their own copy operations, such as fixed-size Eigen types.
+ */
+template <typename T>
+struct is_bitwise_copyable : std::is_trivially_copyable<T> {};
+
+/**
+ * @brief Helper variable template for rsl::is_bitwise_copyable
+ */
+template <typename T>
+constexpr bool is_bitwise_copyable_v = is_bitwise_copyable<T>::value;
+
+/**
+ * @brief Sequence lock for sharing a small value from one writer thread with many reader threads.
+ * Example usage:
+ *
+ * @code
+ * auto pose = rsl::SeqLock<Eigen::Isometry3d>(Eigen::Isometry3d::Identity());
+ * pose.store(measured);             // Real-time writer thread, never blocks
+ * auto const latest = pose.load();  // Any number of reader threads
+ * @endcode
+ *
+ * The writer is wait-free: it bumps a sequence counter to an odd value, writes the value and bumps
+ * the counter to the next even value. Readers copy the value and retry if the counter was odd or
+ * changed during the copy, so readers never delay the writer but may spin while it writes.
+ *
+ * The value is stored as relaxed atomic words, which makes racing reads well defined rather than
+ * relying on a data race on T.
+ *
+ * @tparam T Default constructible value type for which rsl::is_bitwise_copyable holds
+ */
+template <typename T>
+class SeqLock {
+    static_assert(is_bitwise_copyable_v<T>, "T must be bitwise copyable");
+
+    using Word = uint64_t;
+    static constexpr auto word_count = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+    std::atomic<uint64_t> sequence_{0};
+    std::array<std::atomic<Word>, word_count> words_{};
+
+   public:
+    /**
+     * @brief Construct with a value-initialized value
+     */
+    SeqLock() : SeqLock(T{}) {}
+
+    /**
+     * @brief Construct with an initial value
+     */
+    explicit SeqLock(T const& value) { write_words(value); }
+
+    SeqLock(SeqLock const&) = delete;
+    SeqLock(SeqLock&&) = delete;
+    SeqLock& operator=(SeqLock const&) = delete;
+    SeqLock& operator=(SeqLock&&) = delete;
+    ~SeqLock() = default;
+
+    /**
+     * @brief Publish a new value
+     * @pre Only one thread stores at a time
+     */
+    void store(T const& value) noexcept {
+        auto const sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        write_words(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Get a consistent copy of the latest value, retrying while a store is in progress
+     */
+    [[nodiscard]] auto load() const noexcept {
+        while (true) {
+            if (auto value = try_load()) return *value;
+        }
+    }
+
+    /**
+     * @brief Attempt to copy the latest value once without retrying
+     * @return The value, or std::nullopt if a store was in progress
+     */
+    [[nodiscard]] auto try_load() const noexcept -> std::optional<T> {
+        auto const before = sequence_.load(std::memory_order_acquire);
+        if (before % 2 != 0) return std::nullopt;
+
+        auto buffer = std::array<Word, word_count>();
+        for (size_t i = 0; i < word_count; ++i)
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != before) return std::nullopt;
+
+        auto value = std::optional<T>(std::in_place);
+        std::memcpy(static_cast<void*>(&*value), buffer.data(), sizeof(T));
+        return value;
+    }
+
+   private:
+    void write_words(T const& value) noexcept {
+        auto buffer = std::array<Word, word_count>();
+        std::memcpy(buffer.data(), static_cast<void const*>(&value), sizeof(T));
+        for (size_t i = 0; i < word_count; ++i)
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+};
+
+}  // namespace rsl
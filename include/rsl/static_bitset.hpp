@@ -0,0 +1,310 @@
+#pragma once
+
+#include <rsl/static_vector.hpp>
+
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+[[nodiscard]] inline auto popcount(uint64_t word) -> size_t {
+    return std::bitset<64>(word).count();
+}
+
+// Undefined for zero
+[[nodiscard]] inline auto count_trailing_zeros(uint64_t word) -> size_t {
+#if defined(_MSC_VER)
+    auto index = 0UL;
+    _BitScanForward64(&index, word);
+    return index;
+#else
+    return size_t(__builtin_ctzll(word));
+#endif
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Fixed capacity set of the integers [0, capacity), stored as a bit per integer. Example
+ * usage:
+ *
+ * @code
+ * auto const active = rsl::StaticBitSet<64>{0, 3, 5};
+ * active.contains(3); // true
+ * (active & rsl::StaticBitSet<64>{3, 4}).size(); // 1
+ * for (auto const joint : active) {} // 0, 3, 5
+ * @endcode
+ *
+ * Membership tests are O(1), set algebra operates on 64 bits at a time and iteration visits only
+ * the set bits in increasing order.
+ */
+template <size_t capacity>
+class StaticBitSet {
+    static constexpr auto bits_per_word = size_t(64);
+    static constexpr auto word_count = (capacity + bits_per_word - 1) / bits_per_word;
+
+    std::array<uint64_t, word_count> words_{};
+
+   public:
+    /**
+     * @brief Forward iterator over the members of the set in increasing order
+     */
+    class Iterator {
+        std::array<uint64_t, word_count> const* words_ = nullptr;
+        size_t word_index_ = word_count;
+        uint64_t word_ = 0;
+
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = size_t;
+
+        /**
+         * @brief Construct an end iterator
+         */
+        Iterator() = default;
+
+        /**
+         * @brief Construct an iterator at the first member at or after word_index
+         */
+        Iterator(std::array<uint64_t, word_count> const& words, size_t word_index)
+            : words_(&words),
+              word_index_(word_index),
+              word_(word_index < word_count ? words[word_index] : 0) {
+            skip_empty_words();
+        }
+
+        /**
+         * @brief Get the current member
+         */
+        [[nodiscard]] auto operator*() const {
+            return word_index_ * bits_per_word + detail::count_trailing_zeros(word_);
+        }
+
+        /**
+         * @brief Advance to the next member
+         */
+        auto operator++() -> Iterator& {
+            word_ &= word_ - 1;  // Clear the lowest set bit
+            skip_empty_words();
+            return *this;
+        }
+
+        /**
+         * @brief Advance to the next member
+         */
+        auto operator++(int) -> Iterator {
+            auto const copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Compare iterators for equality
+         */
+        [[nodiscard]] friend auto operator==(Iterator const& lhs, Iterator const& rhs) {
+            return lhs.word_index_ == rhs.word_index_ && lhs.word_ == rhs.word_;
+        }
+
+        /**
+         * @brief Compare iterators for inequality
+         */
+        [[nodiscard]] friend auto operator!=(Iterator const& lhs, Iterator const& rhs) {
+            return !(lhs == rhs);
+        }
+
+       private:
+        void skip_empty_words() {
+            while (word_ == 0 && word_index_ < word_count) {
+                if (++word_index_ < word_count) word_ = (*words_)[word_index_];
+            }
+        }
+    };
+
+    /**
+     * @brief Construct an empty set
+     */
+    StaticBitSet() = default;
+
+    /**
+     * @brief Construct from a list of members
+     */
+    StaticBitSet(std::initializer_list<size_t> indices) {
+        for (auto const index : indices) insert(index);
+    }
+
+    /**
+     * @brief Construct from a collection of integral members, e.g. a StaticVector of indices
+     */
+    template <typename Collection,
+              typename = std::enable_if_t<!std::is_same_v<Collection, StaticBitSet>>>
+    explicit StaticBitSet(Collection const& indices) {
+        static_assert(std::is_integral_v<std::decay_t<decltype(*std::cbegin(indices))>>,
+                      "Collection must contain integral indices");
+        for (auto const index : indices) insert(size_t(index));
+    }
+
+    /**
+     * @brief Get a begin iterator
+     */
+    [[nodiscard]] auto begin() const { return Iterator(words_, 0); }
+
+    /**
+     * @brief Get an end iterator
+     */
+    [[nodiscard]] auto end() const { return Iterator(words_, word_count); }
+
+    /**
+     * @brief Get the number of members
+     */
+    [[nodiscard]] auto size() const {
+        auto count = size_t(0);
+        for (auto const word : words_) count += detail::popcount(word);
+        return count;
+    }
+
+    /**
+     * @brief Get the maximum number of members
+     */
+    [[nodiscard]] static constexpr auto max_size() { return capacity; }
+
+    /**
+     * @brief Check if the set is empty
+     */
+    [[nodiscard]] auto empty() const {
+        for (auto const word : words_)
+            if (word != 0) return false;
+        return true;
+    }
+
+    /**
+     * @brief Check if index is a member
+     */
+    [[nodiscard]] auto contains(size_t index) const {
+        return index < capacity && (words_[index / bits_per_word] & bit(index)) != 0;
+    }
+
+    /**
+     * @brief Add index to the set
+     */
+    void insert(size_t index) {
+        assert(index < capacity && "rsl::StaticBitSet::insert: Index exceeds capacity");
+        if (index < capacity) words_[index / bits_per_word] |= bit(index);
+    }
+
+    /**
+     * @brief Remove index from the set
+     */
+    void erase(size_t index) {
+        if (index < capacity) words_[index / bits_per_word] &= ~bit(index);
+    }
+
+    /**
+     * @brief Remove all members
+     */
+    void clear() { words_ = {}; }
+
+    /**
+     * @brief Check if every member of this set is also a member of other
+     */
+    [[nodiscard]] auto is_subset_of(StaticBitSet const& other) const {
+        for (size_t i = 0; i < word_count; ++i)
+            if ((words_[i] & ~other.words_[i]) != 0) return false;
+        return true;
+    }
+
+    /**
+     * @brief Union in place
+     */
+    auto operator|=(StaticBitSet const& other) -> StaticBitSet& {
+        for (size_t i = 0; i < word_count; ++i) words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    /**
+     * @brief Intersection in place
+     */
+    auto operator&=(StaticBitSet const& other) -> StaticBitSet& {
+        for (size_t i = 0; i < word_count; ++i) words_[i] &= other.words_[i];
+        return *this;
+    }
+
+    /**
+     * @brief Difference in place
+     */
+    auto operator-=(StaticBitSet const& other) -> StaticBitSet& {
+        for (size_t i = 0; i < word_count; ++i) words_[i] &= ~other.words_[i];
+        return *this;
+    }
+
+    /**
+     * @brief Union
+     */
+    [[nodiscard]] friend auto operator|(StaticBitSet lhs, StaticBitSet const& rhs) {
+        return lhs |= rhs;
+    }
+
+    /**
+     * @brief Intersection
+     */
+    [[nodiscard]] friend auto operator&(StaticBitSet lhs, StaticBitSet const& rhs) {
+        return lhs &= rhs;
+    }
+
+    /**
+     * @brief Difference
+     */
+    [[nodiscard]] friend auto operator-(StaticBitSet lhs, StaticBitSet const& rhs) {
+        return lhs -= rhs;
+    }
+
+    /**
+     * @brief Compare sets for equality
+     */
+    [[nodiscard]] friend auto operator==(StaticBitSet const& lhs, StaticBitSet const& rhs) {
+        return lhs.words_ == rhs.words_;
+    }
+
+    /**
+     * @brief Compare sets for inequality
+     */
+    [[nodiscard]] friend auto operator!=(StaticBitSet const& lhs, StaticBitSet const& rhs) {
+        return lhs.words_ != rhs.words_;
+    }
+
+   private:
+    [[nodiscard]] static constexpr auto bit(size_t index) -> uint64_t {
+        return uint64_t(1) << (index % bits_per_word);
+    }
+};
+
+/**
+ * @brief Convert to a StaticVector of the members in increasing order
+ */
+template <size_t capacity>
+[[nodiscard]] auto to_static_vector(StaticBitSet<capacity> const& bitset) {
+    auto indices = StaticVector<size_t, capacity>();
+    for (auto const index : bitset) indices.push_back(index);
+    return indices;
+}
+
+}  // namespace rsl
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <functional>
+#include <iterator>
 #include <string>
 #include <string_view>
 
@@ -12,27 +17,46 @@ namespace rsl {
 /**
  * @brief Fixed capacity string with an implicit conversion to std::string_view. Capacity is
  * specified as a template parameter. At runtime one may use up to the specified capacity.
+ *
+ * One extra byte is reserved so the string is always null-terminated, allowing c_str() to be
+ * passed to C APIs without copying.
  */
 template <size_t capacity>
 class StaticString {
-    std::array<std::string::value_type, capacity> data_{};
+    std::array<std::string::value_type, capacity + 1> data_{};
     size_t size_{};
 
    public:
+    /**
+     * @brief Character type, required for std::back_inserter
+     */
+    using value_type = std::string::value_type;
+
     /**
      * @brief Construct an empty string
      */
     StaticString() = default;
 
     /**
-     * @brief Construct from a std::string
+     * @brief Construct from a std::string_view
      */
-    StaticString(std::string const& string) : size_(std::min(string.size(), capacity)) {
+    StaticString(std::string_view string) : size_(std::min(string.size(), capacity)) {
         assert(string.size() <= capacity &&
                "rsl::StaticString::StaticString: Input exceeds capacity");
-        std::copy(string.cbegin(), string.cbegin() + std::string::difference_type(size_),
-                  data_.begin());
+        std::copy_n(string.cbegin(), size_, data_.begin());
+        data_[size_] = '\0';
     }
+
+    /**
+     * @brief Construct from a null-terminated character array
+     */
+    StaticString(char const* string) : StaticString(std::string_view(string)) {}
+
+    /**
+     * @brief Construct from a std::string
+     */
+    StaticString(std::string const& string) : StaticString(std::string_view(string)) {}
+
     /**
      * @brief Get a const begin iterator
      */
@@ -43,6 +67,83 @@ class StaticString {
      */
     [[nodiscard]] auto end() const { return data_.cbegin() + size_; }
 
+    /**
+     * @brief Get a pointer to the underlying null-terminated characters
+     */
+    [[nodiscard]] auto data() const { return data_.data(); }
+
+    /**
+     * @brief Get a pointer to the underlying null-terminated characters
+     */
+    [[nodiscard]] auto c_str() const { return data_.data(); }
+
+    /**
+     * @brief Get the number of characters
+     */
+    [[nodiscard]] auto size() const { return size_; }
+
+    /**
+     * @brief Get the maximum number of characters
+     */
+    [[nodiscard]] static constexpr auto max_size() { return capacity; }
+
+    /**
+     * @brief Check if the string is empty
+     */
+    [[nodiscard]] auto empty() const { return size_ == 0; }
+
+    /**
+     * @brief Get the character at a given position
+     */
+    [[nodiscard]] auto operator[](size_t pos) const {
+        assert(pos < size_ && "rsl::StaticString::operator[]: Index out of range");
+        return data_[pos];
+    }
+
+    /**
+     * @brief Remove all characters
+     */
+    void clear() {
+        size_ = 0;
+        data_[0] = '\0';
+    }
+
+    /**
+     * @brief Append a character, ignoring it if the string is full
+     */
+    void push_back(value_type character) {
+        assert(size_ < capacity && "rsl::StaticString::push_back: Input exceeds capacity");
+        if (size_ == capacity) return;
+        data_[size_++] = character;
+        data_[size_] = '\0';
+    }
+
+    /**
+     * @brief Append a string, truncating it to the remaining capacity
+     */
+    auto append(std::string_view string) -> StaticString& {
+        assert(string.size() <= capacity - size_ &&
+               "rsl::StaticString::append: Input exceeds capacity");
+        auto const count = std::min(string.size(), capacity - size_);
+        std::copy_n(string.cbegin(), count, data_.begin() + std::ptrdiff_t(size_));
+        size_ += count;
+        data_[size_] = '\0';
+        return *this;
+    }
+
+    /**
+     * @brief Append a string, truncating it to the remaining capacity
+     */
+    auto operator+=(std::string_view string) -> StaticString& { return append(string); }
+
+    /**
+     * @brief Append a character, ignoring it if the string is full
+     */
+    auto operator+=(value_type character) -> StaticString& {
+        push_back(character);
+        return *this;
+    }
+
     /**
      * @brief Implicit conversion to std::string_view
      */
@@ -57,4 +158,77 @@ template <size_t capacity>
     return std::string(static_string);
 }
 
+/**
+ * @brief Format into the end of a StaticString without allocating. Example usage:
+ *
+ * @code
+ * auto message = rsl::StaticString<64>("Joint ");
+ * rsl::format_to(message, "{} exceeded limit by {:.3f}", joint_index, error);
+ * @endcode
+ *
+ * Output that does not fit in the remaining capacity is discarded.
+ *
+ * @return True if the whole output fit, false if it was truncated
+ */
+template <size_t capacity, typename... Args>
+auto format_to(StaticString<capacity>& static_string, fmt::format_string<Args...> format,
+               Args&&... args) {
+    auto const available = capacity - static_string.size();
+    auto const result = fmt::format_to_n(std::back_inserter(static_string), available, format,
+                                         std::forward<Args>(args)...);
+    return result.size <= available;
+}
+
+/**
+ * @cond DETAIL
+ */
+#define RSL_STATIC_STRING_COMPARISON(op)                                                     \
+    template <size_t lhs_capacity, size_t rhs_capacity>                                      \
+    [[nodiscard]] auto operator op(StaticString<lhs_capacity> const& lhs,                    \
+                                   StaticString<rhs_capacity> const& rhs) {                  \
+        return std::string_view(lhs) op std::string_view(rhs);                              \
+    }                                                                                        \
+    template <size_t capacity>                                                               \
+    [[nodiscard]] auto operator op(StaticString<capacity> const& lhs, std::string_view rhs) { \
+        return std::string_view(lhs) op rhs;                                                 \
+    }                                                                                        \
+    template <size_t capacity>                                                               \
+    [[nodiscard]] auto operator op(std::string_view lhs, StaticString<capacity> const& rhs) { \
+        return lhs op std::string_view(rhs);                                                 \
+    }
+
+RSL_STATIC_STRING_COMPARISON(==)
+RSL_STATIC_STRING_COMPARISON(!=)
+RSL_STATIC_STRING_COMPARISON(<)
+RSL_STATIC_STRING_COMPARISON(<=)
+RSL_STATIC_STRING_COMPARISON(>)
+RSL_STATIC_STRING_COMPARISON(>=)
+
+#undef RSL_STATIC_STRING_COMPARISON
+/**
+ * @endcond
+ */
+
 }  // namespace rsl
+
+/**
+ * @brief Hash a StaticString the same way as the equivalent std::string_view
+ */
+template <size_t capacity>
+struct std::hash<rsl::StaticString<capacity>> {
+    [[nodiscard]] auto operator()(
+        rsl::StaticString<capacity> const& static_string) const noexcept {
+        return std::hash<std::string_view>()(static_string);
+    }
+};
+
+/**
+ * @brief Format a StaticString the same way as the equivalent std::string_view
+ */
+template <size_t capacity>
+struct fmt::formatter<rsl::StaticString<capacity>> : fmt::formatter<std::string_view> {
+    template <typename FormatContext>
+    auto format(rsl::StaticString<capacity> const& static_string, FormatContext& ctx) const {
+        return fmt::formatter<std::string_view>::format(static_string, ctx);
+    }
+};
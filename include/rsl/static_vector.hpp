@@ -2,21 +2,32 @@
 
 #include <tcb_span/span.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace rsl {
 
 /** @file */
 
+/**
+ * @brief Alignment of StaticVector storage. Arithmetic types are aligned to 16 bytes so the data
+ * can be used with aligned SIMD loads, e.g. through rsl::as_eigen.
+ */
+template <typename T>
+constexpr inline size_t static_vector_alignment =
+    std::is_arithmetic_v<T> ? std::max(alignof(T), size_t(16)) : alignof(T);
+
 /**
  * @brief Fixed capacity vector with an implicit conversion to tcb::span. Capacity is specified as
  * a template parameter. At runtime one may use up to the specified capacity.
  */
 template <typename T, size_t capacity>
 class StaticVector {
-    std::array<T, capacity> data_{};
+    alignas(static_vector_alignment<T>) std::array<T, capacity> data_{};
     size_t size_{};
 
    public:
@@ -62,6 +73,24 @@ class StaticVector {
      */
     [[nodiscard]] auto end() const { return data_.cbegin() + size_; }
 
+    /**
+     * @brief Get the number of elements
+     */
+    [[nodiscard]] auto size() const { return size_; }
+
+    /**
+     * @brief Check if the vector is empty
+     */
+    [[nodiscard]] auto empty() const { return size_ == 0; }
+
+    /**
+     * @brief Append an element, ignoring it if the vector is full
+     */
+    void push_back(T value) {
+        assert(size_ < capacity && "rsl::StaticVector::push_back: Input exceeds capacity");
+        if (size_ < capacity) data_[size_++] = std::move(value);
+    }
+
     /**
      * @brief Implicit conversion to tcb::span<T>
      */
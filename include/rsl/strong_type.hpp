@@ -1,11 +1,62 @@
 #pragma once
 
+#include <tcb_span/span.hpp>
+
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace rsl {
 
 /** @file */
 
+/**
+ * @brief Traits that opt a StrongType tag in to extra operators. Example usage:
+ *
+ * @code
+ * using Meters = rsl::StrongType<double, struct MetersTag>;
+ * template <>
+ * struct rsl::strong_type_traits<MetersTag> {
+ *     static constexpr bool arithmetic = true;
+ * };
+ *
+ * auto const length = Meters(1.) + Meters(0.5) * 2.; // Meters(2.)
+ * @endcode
+ *
+ * @tparam Tag Tag type of the StrongType
+ */
+template <typename Tag>
+struct strong_type_traits {
+    /**
+     * @brief Enable addition and subtraction of values with the same tag, scaling by the value
+     * type, the ratio of two values and comparisons
+     */
+    static constexpr bool arithmetic = false;
+};
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+template <typename Tag, typename Result = void>
+using enable_if_arithmetic_t = std::enable_if_t<strong_type_traits<Tag>::arithmetic, Result>;
+
+// Keeps a parameter out of template argument deduction, so e.g. Meters * 2 deduces T from Meters
+template <typename T>
+struct TypeIdentity {
+    using type = T;
+};
+
+template <typename T>
+using type_identity_t = typename TypeIdentity<T>::type;
+
+template <typename Strong>
+struct StrongTypeValue;
+}  // namespace detail
+/**
+ * @endcond
+ */
+
 /**
  * @brief Class template for creating strong type aliases
  *
@@ -14,13 +65,28 @@ namespace rsl {
  */
 template <typename T, typename Tag>
 class StrongType {
-    T value_;
+    T value_{};
 
    public:
+    /**
+     * @brief Value-initialize the underlying value, so strong types can be held by containers such
+     * as rsl::StaticVector
+     *
+     * Every StrongType is default constructible if T is, e.g. a StrongType<double, Tag> defaults to
+     * zero.
+     */
+    constexpr StrongType() = default;
+
     /**
      * @brief Construct from any type
      */
-    constexpr explicit StrongType(T value) : value_(std::move(value)) {}
+    constexpr explicit StrongType(T value) : value_(std::move(value)) {
+        // rsl::unwrap_span and rsl::wrap_span rely on StrongType being laid out exactly like T
+        static_assert(sizeof(StrongType) == sizeof(T), "StrongType must have the size of T");
+        static_assert(alignof(StrongType) == alignof(T), "StrongType must have the alignment of T");
+        static_assert(std::is_trivially_copyable_v<StrongType> == std::is_trivially_copyable_v<T>,
+                      "StrongType must be trivially copyable if and only if T is");
+    }
 
     /**
      * @brief Get non-const reference to underlying value
@@ -38,4 +104,216 @@ class StrongType {
     [[nodiscard]] constexpr explicit operator T() const { return value_; }
 };
 
+/**
+ * @name Arithmetic operators
+ * Available when rsl::strong_type_traits<Tag>::arithmetic is true. Each is a single operation on
+ * the underlying values, so they compile to the same code as the underlying type.
+ * @{
+ */
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator+(StrongType<T, Tag> const& lhs,
+                                       StrongType<T, Tag> const& rhs) {
+    return StrongType<T, Tag>(lhs.get() + rhs.get());
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator-(StrongType<T, Tag> const& lhs,
+                                       StrongType<T, Tag> const& rhs) {
+    return StrongType<T, Tag>(lhs.get() - rhs.get());
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator-(StrongType<T, Tag> const& value) {
+    return StrongType<T, Tag>(-value.get());
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator*(StrongType<T, Tag> const& lhs,
+                                       detail::type_identity_t<T> const& rhs) {
+    return StrongType<T, Tag>(lhs.get() * rhs);
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator*(detail::type_identity_t<T> const& lhs,
+                                       StrongType<T, Tag> const& rhs) {
+    return StrongType<T, Tag>(lhs * rhs.get());
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator/(StrongType<T, Tag> const& lhs,
+                                       detail::type_identity_t<T> const& rhs) {
+    return StrongType<T, Tag>(lhs.get() / rhs);
+}
+
+/**
+ * @brief Ratio of two values with the same tag, which has no tag
+ */
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator/(StrongType<T, Tag> const& lhs, StrongType<T, Tag> const& rhs)
+    -> T {
+    return lhs.get() / rhs.get();
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+constexpr auto operator+=(StrongType<T, Tag>& lhs, StrongType<T, Tag> const& rhs)
+    -> StrongType<T, Tag>& {
+    lhs.get() += rhs.get();
+    return lhs;
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+constexpr auto operator-=(StrongType<T, Tag>& lhs, StrongType<T, Tag> const& rhs)
+    -> StrongType<T, Tag>& {
+    lhs.get() -= rhs.get();
+    return lhs;
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+constexpr auto operator*=(StrongType<T, Tag>& lhs, detail::type_identity_t<T> const& rhs)
+    -> StrongType<T, Tag>& {
+    lhs.get() *= rhs;
+    return lhs;
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+constexpr auto operator/=(StrongType<T, Tag>& lhs, detail::type_identity_t<T> const& rhs)
+    -> StrongType<T, Tag>& {
+    lhs.get() /= rhs;
+    return lhs;
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator==(StrongType<T, Tag> const& lhs,
+                                        StrongType<T, Tag> const& rhs) -> bool {
+    return lhs.get() == rhs.get();
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator!=(StrongType<T, Tag> const& lhs,
+                                        StrongType<T, Tag> const& rhs) -> bool {
+    return lhs.get() != rhs.get();
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator<(StrongType<T, Tag> const& lhs, StrongType<T, Tag> const& rhs)
+    -> bool {
+    return lhs.get() < rhs.get();
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator<=(StrongType<T, Tag> const& lhs,
+                                        StrongType<T, Tag> const& rhs) -> bool {
+    return lhs.get() <= rhs.get();
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator>(StrongType<T, Tag> const& lhs, StrongType<T, Tag> const& rhs)
+    -> bool {
+    return lhs.get() > rhs.get();
+}
+
+template <typename T, typename Tag, typename = detail::enable_if_arithmetic_t<Tag>>
+[[nodiscard]] constexpr auto operator>=(StrongType<T, Tag> const& lhs,
+                                        StrongType<T, Tag> const& rhs) -> bool {
+    return lhs.get() >= rhs.get();
+}
+/** @} */
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+template <typename T, typename Tag>
+struct StrongTypeValue<StrongType<T, Tag>> {
+    using type = T;
+};
+
+template <typename Strong, typename T>
+constexpr auto check_span_layout() {
+    static_assert(sizeof(Strong) == sizeof(T) && alignof(Strong) == alignof(T),
+                  "StrongType must be laid out like T");
+    static_assert(std::is_standard_layout_v<Strong> && std::is_trivially_copyable_v<T>,
+                  "Only spans of trivially copyable, standard layout types can be reinterpreted");
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief View a span of strong types as a span of their underlying values without copying.
+ * Example usage:
+ *
+ * @code
+ * using Radians = rsl::StrongType<double, struct RadiansTag>;
+ * auto angles = std::vector{Radians(0.1), Radians(0.2)};
+ * auto const values = rsl::unwrap_span(angles); // tcb::span<double>
+ * auto const sum = std::accumulate(values.begin(), values.end(), 0.);
+ * @endcode
+ *
+ * @param span Contiguous strong types to view
+ *
+ * @return Span of the same extent over the underlying values
+ */
+template <typename T, typename Tag, size_t extent>
+[[nodiscard]] auto unwrap_span(tcb::span<StrongType<T, Tag>, extent> span) {
+    detail::check_span_layout<StrongType<T, Tag>, T>();
+    return tcb::span<T, extent>(reinterpret_cast<T*>(span.data()), span.size());  // NOLINT
+}
+
+/**
+ * @brief View a span of const strong types as a span of their const underlying values
+ */
+template <typename T, typename Tag, size_t extent>
+[[nodiscard]] auto unwrap_span(tcb::span<StrongType<T, Tag> const, extent> span) {
+    detail::check_span_layout<StrongType<T, Tag>, T>();
+    return tcb::span<T const, extent>(reinterpret_cast<T const*>(span.data()),  // NOLINT
+                                      span.size());
+}
+
+/**
+ * @brief View a contiguous collection of strong types, e.g. a std::vector or rsl::StaticVector,
+ * as a span of their underlying values
+ */
+template <typename Collection>
+[[nodiscard]] auto unwrap_span(Collection& collection) {
+    using Element = std::remove_reference_t<decltype(*std::begin(collection))>;
+    return unwrap_span(tcb::span<Element>(collection));
+}
+
+/**
+ * @brief View a span of values as a span of strong types without copying. Example usage:
+ *
+ * @code
+ * using Radians = rsl::StrongType<double, struct RadiansTag>;
+ * auto const values = std::vector{0.1, 0.2};
+ * auto const angles = rsl::wrap_span<Radians>(values); // tcb::span<Radians const>
+ * @endcode
+ *
+ * @tparam Strong StrongType to view the values as
+ * @param span Contiguous values to view
+ *
+ * @return Span of the same extent over the strong types, const if the values are
+ */
+template <typename Strong, typename T, size_t extent>
+[[nodiscard]] auto wrap_span(tcb::span<T, extent> span) {
+    using Value = typename detail::StrongTypeValue<Strong>::type;
+    static_assert(std::is_same_v<std::remove_const_t<T>, Value>,
+                  "Strong must be a StrongType of the span's element type");
+    detail::check_span_layout<Strong, Value>();
+    using Element = std::conditional_t<std::is_const_v<T>, Strong const, Strong>;
+    return tcb::span<Element, extent>(reinterpret_cast<Element*>(span.data()),  // NOLINT
+                                      span.size());
+}
+
+/**
+ * @brief View a contiguous collection of values, e.g. a std::vector or rsl::StaticVector, as a
+ * span of strong types
+ */
+template <typename Strong, typename Collection>
+[[nodiscard]] auto wrap_span(Collection& collection) {
+    using Element = std::remove_reference_t<decltype(*std::begin(collection))>;
+    return wrap_span<Strong>(tcb::span<Element>(collection));
+}
+
 }  // namespace rsl
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <rsl/export.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+struct SymbolEntry {
+    size_t hash;
+    uint32_t id;
+    std::string name;
+};
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Interned string for cheap comparison and hashing. Example usage:
+ *
+ * @code
+ * auto const joint = rsl::Symbol("shoulder_pan_joint");
+ * joint == rsl::Symbol("shoulder_pan_joint"); // true, compares handles
+ * joint.view(); // "shoulder_pan_joint"
+ * @endcode
+ *
+ * Symbols are stored in a process-wide table. Constructing a Symbol from a name that has already
+ * been interned is lock-free; interning a new name takes a lock. Each distinct name is assigned a
+ * small integer id in the order it was first interned, and its text stays valid for the life of
+ * the program. Since entries are never removed, avoid interning unbounded sets of names.
+ */
+class Symbol {
+    detail::SymbolEntry const* entry_;
+
+   public:
+    /**
+     * @brief Construct the symbol for the empty string
+     */
+    Symbol() : Symbol(std::string_view()) {}
+
+    /**
+     * @brief Intern a name
+     */
+    RSL_EXPORT explicit Symbol(std::string_view name);
+
+    /**
+     * @brief Get the id of the symbol. Ids are assigned in the order names are first interned.
+     */
+    [[nodiscard]] auto id() const { return entry_->id; }
+
+    /**
+     * @brief Get the interned text
+     */
+    [[nodiscard]] auto view() const -> std::string_view { return entry_->name; }
+
+    /**
+     * @brief Get the hash of the interned text, identical to std::hash<std::string_view>
+     */
+    [[nodiscard]] auto hash() const { return entry_->hash; }
+
+    /**
+     * @brief Compare handles for equality
+     */
+    [[nodiscard]] friend auto operator==(Symbol const& lhs, Symbol const& rhs) {
+        return lhs.entry_ == rhs.entry_;
+    }
+
+    /**
+     * @brief Compare handles for inequality
+     */
+    [[nodiscard]] friend auto operator!=(Symbol const& lhs, Symbol const& rhs) {
+        return lhs.entry_ != rhs.entry_;
+    }
+
+    /**
+     * @brief Order by id, which is not lexicographic order
+     */
+    [[nodiscard]] friend auto operator<(Symbol const& lhs, Symbol const& rhs) {
+        return lhs.id() < rhs.id();
+    }
+};
+
+}  // namespace rsl
+
+/**
+ * @brief Hash a Symbol using its precomputed hash
+ */
+template <>
+struct std::hash<rsl::Symbol> {
+    [[nodiscard]] auto operator()(rsl::Symbol const& symbol) const noexcept {
+        return symbol.hash();
+    }
+};
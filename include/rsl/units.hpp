@@ -0,0 +1,275 @@
+#pragma once
+
+#include <rsl/strong_type.hpp>
+
+#include <ratio>
+#include <type_traits>
+
+namespace rsl {
+
+/** @file */
+
+/**
+ * @brief Physical dimension as exponents of the base quantities, e.g. velocity is
+ * Dimension<1, 0, -1, 0>. Angles are a separate base quantity so radians are not dimensionless.
+ */
+template <int length, int mass, int time, int angle>
+struct Dimension {};
+
+/**
+ * @brief Unit of measure, used as the tag of a rsl::Quantity
+ *
+ * @tparam Dim rsl::Dimension of the unit
+ * @tparam Scale Size of the unit in SI base units, either a std::ratio or a type with a static
+ * constexpr member value for irrational scales such as degrees
+ */
+template <typename Dim, typename Scale = std::ratio<1>>
+struct Unit {};
+
+/**
+ * @brief Value with a unit, checked at compile time. Example usage:
+ *
+ * @code
+ * using namespace rsl::units;
+ * auto const distance = Meters(3.);
+ * auto const speed = distance / Seconds(2.); // MetersPerSecond(1.5)
+ * auto const offset = rsl::unit_cast<Meters>(Millimeters(250.)); // Meters(0.25)
+ * auto const wrong = distance + Seconds(1.); // Does not compile
+ * @endcode
+ *
+ * A quantity is a rsl::StrongType whose tag is a rsl::Unit, so it holds a single T and nothing
+ * else. Values with the same unit support the arithmetic operators of StrongType. Multiplying and
+ * dividing quantities adds and subtracts the dimensions of their units and multiplies and divides
+ * the scales, all at compile time, so the generated code is the one multiply or divide it would be
+ * for T. Dimensionless results, such as the ratio of two lengths, are plain T values.
+ *
+ * @tparam T Value type
+ * @tparam U rsl::Unit of the value
+ */
+template <typename T, typename U>
+using Quantity = StrongType<T, U>;
+
+/**
+ * @brief Quantities support arithmetic
+ */
+template <typename Dim, typename Scale>
+struct strong_type_traits<Unit<Dim, Scale>> {
+    static constexpr bool arithmetic = true;
+};
+
+/**
+ * @cond DETAIL
+ */
+namespace detail {
+template <typename Lhs, typename Rhs>
+struct DimensionProduct;
+
+template <int l1, int m1, int t1, int a1, int l2, int m2, int t2, int a2>
+struct DimensionProduct<Dimension<l1, m1, t1, a1>, Dimension<l2, m2, t2, a2>> {
+    using type = Dimension<l1 + l2, m1 + m2, t1 + t2, a1 + a2>;
+};
+
+template <typename Dim>
+struct DimensionInverse;
+
+template <int l, int m, int t, int a>
+struct DimensionInverse<Dimension<l, m, t, a>> {
+    using type = Dimension<-l, -m, -t, -a>;
+};
+
+template <typename Scale>
+struct IsRatio : std::false_type {};
+
+template <intmax_t num, intmax_t den>
+struct IsRatio<std::ratio<num, den>> : std::true_type {};
+
+template <typename Scale>
+[[nodiscard]] constexpr auto scale_value() -> double {
+    if constexpr (IsRatio<Scale>::value)
+        return double(Scale::num) / double(Scale::den);
+    else
+        return Scale::value;
+}
+
+template <typename Lhs, typename Rhs>
+struct IrrationalScaleProduct {
+    static constexpr double value = scale_value<Lhs>() * scale_value<Rhs>();
+};
+
+template <typename Scale>
+struct IrrationalScaleInverse {
+    static constexpr double value = 1. / scale_value<Scale>();
+};
+
+// Rational scales stay std::ratio in lowest terms, so e.g. meters divided by seconds is the same
+// type however it was formed. std::ratio_divide must only be formed for ratios.
+template <typename Scale, bool = IsRatio<Scale>::value>
+struct ScaleInverse {
+    using type = IrrationalScaleInverse<Scale>;
+};
+
+template <typename Scale>
+struct ScaleInverse<Scale, true> {
+    using type = typename std::ratio_divide<std::ratio<1>, Scale>::type;
+};
+
+template <typename Scale>
+struct ScaleInverse<IrrationalScaleInverse<Scale>, false> {
+    using type = Scale;
+};
+
+// Irrational scales are simplified where one factor is one or the factors cancel, so e.g. degrees
+// times seconds divided by seconds are degrees again
+template <typename Lhs, typename Rhs, bool = IsRatio<Lhs>::value && IsRatio<Rhs>::value>
+struct ScaleProduct {
+    using type = IrrationalScaleProduct<Lhs, Rhs>;
+};
+
+template <typename Scale>
+struct ScaleProduct<Scale, std::ratio<1>, false> {
+    using type = Scale;
+};
+
+template <typename Scale>
+struct ScaleProduct<std::ratio<1>, Scale, false> {
+    using type = Scale;
+};
+
+template <typename Scale>
+struct ScaleProduct<Scale, IrrationalScaleInverse<Scale>, false> {
+    using type = std::ratio<1>;
+};
+
+template <typename Scale>
+struct ScaleProduct<IrrationalScaleInverse<Scale>, Scale, false> {
+    using type = std::ratio<1>;
+};
+
+template <typename Lhs, typename Rhs>
+struct ScaleProduct<Lhs, Rhs, true> {
+    using type = typename std::ratio_multiply<Lhs, Rhs>::type;
+};
+
+template <typename Q>
+struct QuantityTraits;
+
+template <typename T, typename D, typename S>
+struct QuantityTraits<Quantity<T, Unit<D, S>>> {
+    using Value = T;
+    using Dimension = D;
+    using Scale = S;
+};
+
+// Multiply a value by a scale. Rational scales are applied to integral values as exact integer
+// arithmetic, so e.g. 2500 millimeters are 2 meters rather than 2500 * T(0.001) == 0.
+template <typename T, typename Scale>
+[[nodiscard]] constexpr auto apply_scale(T value) -> T {
+    if constexpr (IsRatio<Scale>::value) {
+        if constexpr (Scale::num == Scale::den)
+            return value;
+        else if constexpr (std::is_floating_point_v<T>)
+            return value * T(scale_value<Scale>());
+        else
+            return T(std::common_type_t<T, intmax_t>(value) * Scale::num / Scale::den);
+    } else {
+        static_assert(std::is_floating_point_v<T>,
+                      "Irrational scales require a floating point value type");
+        return value * T(Scale::value);
+    }
+}
+
+// A quantity of the given unit, or a plain T scaled to SI units if it is dimensionless
+template <typename T, typename Dim, typename Scale>
+[[nodiscard]] constexpr auto make_quantity(T value) {
+    if constexpr (std::is_same_v<Dim, Dimension<0, 0, 0, 0>>)
+        return apply_scale<T, Scale>(value);
+    else
+        return Quantity<T, Unit<Dim, Scale>>(value);
+}
+}  // namespace detail
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Convert a quantity to another unit of the same dimension
+ *
+ * The conversion factor is computed at compile time, so this is at most one multiply, or a
+ * multiply and a truncating divide for integral value types.
+ *
+ * @tparam To Quantity type to convert to
+ */
+template <typename To, typename T, typename Dim, typename Scale>
+[[nodiscard]] constexpr auto unit_cast(Quantity<T, Unit<Dim, Scale>> const& quantity) -> To {
+    using Traits = detail::QuantityTraits<To>;
+    static_assert(std::is_same_v<typename Traits::Value, T>,
+                  "Quantities must have the same value type");
+    static_assert(std::is_same_v<typename Traits::Dimension, Dim>,
+                  "Units must have the same dimension");
+    if constexpr (std::is_same_v<typename Traits::Scale, Scale>) {
+        return quantity;
+    } else {
+        using Factor = typename detail::ScaleProduct<
+            Scale, typename detail::ScaleInverse<typename Traits::Scale>::type>::type;
+        return To(detail::apply_scale<T, Factor>(quantity.get()));
+    }
+}
+
+/**
+ * @brief Product of two quantities, with the dimensions added and the scales multiplied
+ */
+template <typename T, typename Dim1, typename Scale1, typename Dim2, typename Scale2>
+[[nodiscard]] constexpr auto operator*(Quantity<T, Unit<Dim1, Scale1>> const& lhs,
+                                       Quantity<T, Unit<Dim2, Scale2>> const& rhs) {
+    using Dim = typename detail::DimensionProduct<Dim1, Dim2>::type;
+    using Scale = typename detail::ScaleProduct<Scale1, Scale2>::type;
+    return detail::make_quantity<T, Dim, Scale>(lhs.get() * rhs.get());
+}
+
+/**
+ * @brief Quotient of two quantities with different units, with the dimensions subtracted and the
+ * scales divided
+ */
+template <typename T, typename Dim1, typename Scale1, typename Dim2, typename Scale2,
+          typename = std::enable_if_t<!std::is_same_v<Unit<Dim1, Scale1>, Unit<Dim2, Scale2>>>>
+[[nodiscard]] constexpr auto operator/(Quantity<T, Unit<Dim1, Scale1>> const& lhs,
+                                       Quantity<T, Unit<Dim2, Scale2>> const& rhs) {
+    using Dim = typename detail::DimensionProduct<
+        Dim1, typename detail::DimensionInverse<Dim2>::type>::type;
+    using Scale =
+        typename detail::ScaleProduct<Scale1, typename detail::ScaleInverse<Scale2>::type>::type;
+    return detail::make_quantity<T, Dim, Scale>(lhs.get() / rhs.get());
+}
+
+/**
+ * @brief Common units
+ */
+namespace units {
+/**
+ * @brief Scale of degrees in radians
+ */
+struct DegreeScale {
+    static constexpr double value = 3.1415926535897932385 / 180.;
+};
+
+using Length = Dimension<1, 0, 0, 0>;
+using Mass = Dimension<0, 1, 0, 0>;
+using Time = Dimension<0, 0, 1, 0>;
+using Angle = Dimension<0, 0, 0, 1>;
+using Velocity = Dimension<1, 0, -1, 0>;
+using Acceleration = Dimension<1, 0, -2, 0>;
+using AngularVelocity = Dimension<0, 0, -1, 1>;
+
+using Meters = Quantity<double, Unit<Length>>;
+using Millimeters = Quantity<double, Unit<Length, std::milli>>;
+using Kilograms = Quantity<double, Unit<Mass>>;
+using Seconds = Quantity<double, Unit<Time>>;
+using Milliseconds = Quantity<double, Unit<Time, std::milli>>;
+using Radians = Quantity<double, Unit<Angle>>;
+using Degrees = Quantity<double, Unit<Angle, DegreeScale>>;
+using MetersPerSecond = Quantity<double, Unit<Velocity>>;
+using MetersPerSecondSquared = Quantity<double, Unit<Acceleration>>;
+using RadiansPerSecond = Quantity<double, Unit<AngularVelocity>>;
+}  // namespace units
+
+}  // namespace rsl
@@ -0,0 +1,89 @@
+#include <rsl/no_alloc_guard.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+namespace rsl {
+
+namespace {
+struct ThreadState {
+    size_t allocation_count = 0;
+    NoAllocGuard::Policy policy = NoAllocGuard::Policy::count;
+    bool active = false;
+};
+
+// Constant initialized and trivially destructible, so the thread_local needs neither a lazy
+// initialization guard nor a registered destructor, and operator new can touch it during thread
+// startup
+static_assert(ThreadState().allocation_count == 0, "ThreadState must be constant initialized");
+static_assert(std::is_trivially_destructible_v<ThreadState>,
+              "ThreadState must be trivially destructible");
+thread_local auto thread_state = ThreadState();
+
+#ifdef RSL_ENABLE_NO_ALLOC_GUARD
+void on_allocation() {
+    auto& state = thread_state;
+    if (!state.active) return;
+    ++state.allocation_count;
+    if (state.policy == NoAllocGuard::Policy::abort) {
+        // Avoid anything that could allocate on the way out
+        std::fputs("rsl::NoAllocGuard: Heap allocation in guarded section\n", stderr);
+        std::abort();
+    }
+}
+#endif
+}  // namespace
+
+NoAllocGuard::NoAllocGuard(Policy policy)
+    : initial_count_(thread_state.allocation_count),
+      previous_policy_(thread_state.policy),
+      previous_active_(thread_state.active) {
+    thread_state.policy = policy;
+    thread_state.active = true;
+}
+
+NoAllocGuard::~NoAllocGuard() {
+    thread_state.policy = previous_policy_;
+    thread_state.active = previous_active_;
+}
+
+auto NoAllocGuard::allocation_count() const -> size_t {
+    return thread_state.allocation_count - initial_count_;
+}
+
+}  // namespace rsl
+
+#ifdef RSL_ENABLE_NO_ALLOC_GUARD
+
+// The standard library implements the array and nothrow forms in terms of these
+
+void* operator new(std::size_t size) {
+    rsl::on_allocation();
+    if (size == 0) size = 1;
+    if (auto* const ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    rsl::on_allocation();
+    auto const align = static_cast<std::size_t>(alignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    size = (size + align - 1) / align * align;
+    if (size == 0) size = align;
+    if (auto* const ptr = std::aligned_alloc(align, size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    std::free(ptr);
+}
+
+#endif
@@ -0,0 +1,225 @@
+#include <rsl/quasi_random.hpp>
+#include <rsl/random.hpp>
+
+#include <bitset>
+#include <cassert>
+#include <cmath>
+
+namespace rsl {
+
+namespace {
+constexpr auto pi = 3.1415926535897932385;
+
+// Degree, coefficients and initial direction numbers of dimensions 2 through 21 from
+// new-joe-kuo-6.21201, https://web.maths.unsw.edu.au/~fkuo/sobol/
+struct SobolPolynomial {
+    uint32_t degree;
+    uint32_t coefficients;
+    std::array<uint32_t, 7> initial;
+};
+
+constexpr auto sobol_polynomials = std::array<SobolPolynomial, Sobol::max_dimensions - 1>{{
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+}};
+
+using Directions = std::array<uint32_t, 32>;
+
+// Direction numbers with the first binary digit in the most significant bit
+auto sobol_directions(size_t dimension) -> Directions {
+    auto directions = Directions();
+    if (dimension == 0) {
+        for (size_t i = 0; i < directions.size(); ++i) directions[i] = uint32_t(1) << (31 - i);
+        return directions;
+    }
+
+    auto const& [degree, coefficients, initial] = sobol_polynomials[dimension - 1];
+    for (size_t i = 0; i < degree; ++i) directions[i] = initial[i] << (31 - i);
+    for (auto i = size_t(degree); i < directions.size(); ++i) {
+        auto direction = directions[i - degree] ^ (directions[i - degree] >> degree);
+        for (size_t k = 1; k < degree; ++k) {
+            if ((coefficients >> (degree - 1 - k)) & 1) direction ^= directions[i - k];
+        }
+        directions[i] = direction;
+    }
+    return directions;
+}
+
+// Multiply each direction number by a random lower triangular binary matrix with unit diagonal,
+// where row k gives output digit k as a combination of input digits 0 through k
+auto scramble(Directions const& directions, SplitMix64& engine) -> Directions {
+    auto rows = std::array<uint32_t, 32>();
+    for (size_t k = 0; k < rows.size(); ++k) {
+        auto const digit = uint32_t(1) << (31 - k);
+        auto const earlier_digits = ~(2 * digit - 1);
+        rows[k] = digit | (uint32_t(engine()) & earlier_digits);
+    }
+
+    auto scrambled = Directions();
+    for (size_t i = 0; i < directions.size(); ++i) {
+        for (size_t k = 0; k < rows.size(); ++k) {
+            auto const parity = std::bitset<32>(rows[k] & directions[i]).count() % 2;
+            scrambled[i] |= uint32_t(parity) << (31 - k);
+        }
+    }
+    return scrambled;
+}
+
+auto radical_inverse(uint64_t index, uint32_t base) -> double {
+    auto inverse = 0.;
+    auto const inverse_base = 1. / base;
+    auto digit_value = inverse_base;
+    for (; index > 0; index /= base) {
+        inverse += double(index % base) * digit_value;
+        digit_value *= inverse_base;
+    }
+    return inverse;
+}
+
+// Polar angle and azimuth of the center of a HEALPix pixel in the ring scheme, from "HEALPix: A
+// Framework for High-Resolution Discretization and Fast Analysis of Data Distributed on the
+// Sphere", Gorski et al., 2005
+auto healpix_center(uint64_t pixel, uint64_t resolution) -> std::pair<double, double> {
+    auto const n = double(resolution);
+    auto const cap_pixels = 2 * resolution * (resolution - 1);
+    auto const cap_ring = [](uint64_t cap_pixel) {
+        auto ring = uint64_t((1. + std::sqrt(1. + 2. * double(cap_pixel))) / 2.);
+        while (2 * ring * (ring - 1) > cap_pixel) --ring;  // Guard against rounding
+        while (2 * (ring + 1) * ring <= cap_pixel) ++ring;
+        return ring;
+    };
+
+    if (pixel < cap_pixels) {
+        auto const ring = cap_ring(pixel);
+        auto const offset = double(pixel - 2 * ring * (ring - 1));
+        auto const z = 1. - double(ring * ring) / (3. * n * n);
+        return {std::acos(z), pi / (2. * double(ring)) * (offset + 0.5)};
+    }
+
+    auto const pixel_count = 12 * resolution * resolution;
+    if (pixel < pixel_count - cap_pixels) {
+        auto const equatorial_pixel = pixel - cap_pixels;
+        auto const ring = equatorial_pixel / (4 * resolution) + resolution;
+        auto const offset = double(equatorial_pixel % (4 * resolution));
+        auto const shift = double((ring - resolution + 1) % 2);
+        auto const z = 4. / 3. - 2. * double(ring) / (3. * n);
+        return {std::acos(z), pi / (2. * n) * (offset + 1. - shift / 2.)};
+    }
+
+    auto const mirrored_pixel = pixel_count - 1 - pixel;
+    auto const ring = cap_ring(mirrored_pixel);
+    auto const offset = double(mirrored_pixel - 2 * ring * (ring - 1));
+    auto const z = 1. - double(ring * ring) / (3. * n * n);
+    return {std::acos(-z), pi / (2. * double(ring)) * (offset + 0.5)};
+}
+}  // namespace
+
+Halton::Halton(size_t dimensions) {
+    bases_.reserve(dimensions);
+    for (auto candidate = uint32_t(2); bases_.size() < dimensions; ++candidate) {
+        auto is_prime = true;
+        for (auto const prime : bases_) {
+            if (prime * prime > candidate) break;
+            if (candidate % prime == 0) is_prime = false;
+        }
+        if (is_prime) bases_.push_back(candidate);
+    }
+}
+
+auto Halton::value(uint64_t index, size_t dimension) const -> double {
+    assert(dimension < bases_.size() && "rsl::Halton::value: Dimension out of range");
+    return radical_inverse(index, bases_[dimension]);
+}
+
+auto Halton::point(uint64_t index) const -> Eigen::VectorXd {
+    auto point = Eigen::VectorXd(Eigen::Index(bases_.size()));
+    for (size_t d = 0; d < bases_.size(); ++d) point(Eigen::Index(d)) = value(index, d);
+    return point;
+}
+
+auto Halton::points(uint64_t first_index, size_t count) const -> Eigen::MatrixXd {
+    auto points = Eigen::MatrixXd(Eigen::Index(bases_.size()), Eigen::Index(count));
+    for (size_t i = 0; i < count; ++i) points.col(Eigen::Index(i)) = point(first_index + i);
+    return points;
+}
+
+Sobol::Sobol(size_t dimensions) : shifts_(dimensions) {
+    assert(dimensions <= max_dimensions && "rsl::Sobol::Sobol: Too many dimensions");
+    for (size_t d = 0; d < dimensions; ++d) directions_.push_back(sobol_directions(d));
+}
+
+Sobol::Sobol(size_t dimensions, uint64_t seed) : Sobol(dimensions) {
+    auto engine = SplitMix64(seed);
+    for (size_t d = 0; d < dimensions; ++d) {
+        directions_[d] = scramble(directions_[d], engine);
+        shifts_[d] = uint32_t(engine());
+    }
+}
+
+auto Sobol::value(uint64_t index, size_t dimension) const -> double {
+    assert(dimension < directions_.size() && "rsl::Sobol::value: Dimension out of range");
+    assert(index <= UINT32_MAX && "rsl::Sobol::value: Index out of range");
+    auto const& directions = directions_[dimension];
+    auto bits = shifts_[dimension];
+    for (size_t j = 0; index > 0; index >>= 1, ++j) {
+        if (index & 1) bits ^= directions[j];
+    }
+    return double(bits) * 0x1.0p-32;
+}
+
+auto Sobol::point(uint64_t index) const -> Eigen::VectorXd {
+    auto point = Eigen::VectorXd(Eigen::Index(directions_.size()));
+    for (size_t d = 0; d < directions_.size(); ++d) point(Eigen::Index(d)) = value(index, d);
+    return point;
+}
+
+auto Sobol::points(uint64_t first_index, size_t count) const -> Eigen::MatrixXd {
+    auto points = Eigen::MatrixXd(Eigen::Index(directions_.size()), Eigen::Index(count));
+    for (size_t i = 0; i < count; ++i) points.col(Eigen::Index(i)) = point(first_index + i);
+    return points;
+}
+
+SO3Grid::SO3Grid(size_t level) : resolution_(uint64_t(1) << level) {
+    assert(level < 20 && "rsl::SO3Grid::SO3Grid: Level too large");
+}
+
+auto SO3Grid::size() const -> size_t {
+    return size_t(72 * resolution_ * resolution_ * resolution_);
+}
+
+auto SO3Grid::quaternion(size_t index) const -> Eigen::Quaterniond {
+    assert(index < size() && "rsl::SO3Grid::quaternion: Index out of range");
+    auto const angle_count = 6 * resolution_;
+    auto const [theta, phi] = healpix_center(index / angle_count, resolution_);
+    auto const psi = 2. * pi * (double(index % angle_count) + 0.5) / double(angle_count);
+    return Eigen::Quaterniond(std::cos(theta / 2) * std::cos(psi / 2),
+                              std::cos(theta / 2) * std::sin(psi / 2),
+                              std::sin(theta / 2) * std::cos(phi + psi / 2),
+                              std::sin(theta / 2) * std::sin(phi + psi / 2));
+}
+
+auto SO3Grid::quaternions() const -> Eigen::Matrix4Xd {
+    auto quaternions = Eigen::Matrix4Xd(4, Eigen::Index(size()));
+    for (size_t i = 0; i < size(); ++i) quaternions.col(Eigen::Index(i)) = quaternion(i).coeffs();
+    return quaternions;
+}
+
+}  // namespace rsl
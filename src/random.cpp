@@ -2,47 +2,115 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <functional>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <type_traits>
 
 namespace rsl {
 
-auto rng(std::seed_seq seed_sequence) -> std::mt19937& {
-    thread_local auto generator = std::optional<std::mt19937>();
+namespace {
+struct GlobalSeed {
+    std::mutex mutex;
+    std::optional<uint64_t> seed;
+    uint64_t next_automatic_stream = 0;
+};
+
+auto global_seed() -> GlobalSeed& {
+    static auto instance = GlobalSeed();
+    return instance;
+}
+
+template <typename Engine>
+auto make_thread_engine(std::seed_seq& seed_sequence, std::optional<uint64_t> stream) -> Engine& {
+    thread_local auto generator = std::optional<Engine>();
 
     // Prevent reseeding the generator
-    if (generator.has_value() && seed_sequence.size() > 0)
+    if (generator.has_value() && (seed_sequence.size() > 0 || stream.has_value()))
         throw std::runtime_error("rng cannot be re-seeded on this thread");
 
     // Return existing generator
-    if (generator.has_value() && seed_sequence.size() == 0) return generator.value();
+    if (generator.has_value()) return generator.value();
 
     // Seed with specified sequence
     if (seed_sequence.size() > 0) return generator.emplace(seed_sequence);
 
-    // Seed with randomized sequence
-    auto seed_data = std::array<std::random_device::result_type, std::mt19937::state_size>();
+    // Seed with a stream of the global seed
+    auto const automatic = !stream.has_value();
+    auto seed = std::optional<uint64_t>();
+    {
+        auto& global = global_seed();
+        auto const lock = std::lock_guard(global.mutex);
+        seed = global.seed;
+        if (seed.has_value() && automatic) stream = global.next_automatic_stream++;
+    }
+    if (!automatic && !seed.has_value())
+        throw std::runtime_error("rng_stream requires set_global_seed to be called first");
+    if (seed.has_value())
+        return generator.emplace(detail::make_stream_engine<Engine>(*seed, *stream, automatic));
+
+    // Seed with randomized sequence, using as many words as the generator has state
+    constexpr auto seed_size = std::is_same_v<Engine, std::mt19937> ? std::mt19937::state_size
+                                                                     : sizeof(Engine) / 4;
+    auto seed_data = std::array<std::random_device::result_type, seed_size>();
     auto random_device = std::random_device();
     std::generate_n(seed_data.data(), seed_data.size(), std::ref(random_device));
     auto sequence = std::seed_seq(seed_data.begin(), seed_data.end());
     return generator.emplace(sequence);
 }
+}  // namespace
+
+namespace detail {
+auto thread_engine(EngineTag<std::mt19937>, std::seed_seq& seed_sequence,
+                   std::optional<uint64_t> stream) -> std::mt19937& {
+    return make_thread_engine<std::mt19937>(seed_sequence, stream);
+}
+
+auto thread_engine(EngineTag<SplitMix64>, std::seed_seq& seed_sequence,
+                   std::optional<uint64_t> stream) -> SplitMix64& {
+    return make_thread_engine<SplitMix64>(seed_sequence, stream);
+}
+
+auto thread_engine(EngineTag<Xoshiro256PlusPlus>, std::seed_seq& seed_sequence,
+                   std::optional<uint64_t> stream) -> Xoshiro256PlusPlus& {
+    return make_thread_engine<Xoshiro256PlusPlus>(seed_sequence, stream);
+}
+
+auto thread_engine(EngineTag<Pcg64>, std::seed_seq& seed_sequence,
+                   std::optional<uint64_t> stream) -> Pcg64& {
+    return make_thread_engine<Pcg64>(seed_sequence, stream);
+}
+}  // namespace detail
+
+// Not declared in the header. Keeps the symbol exported by versions where rsl::rng was a
+// non-template function, so binaries built against them still link.
+RSL_EXPORT auto rng(std::seed_seq seed_sequence) -> std::mt19937&;
+auto rng(std::seed_seq seed_sequence) -> std::mt19937& {
+    return detail::thread_engine(detail::EngineTag<std::mt19937>(), seed_sequence, std::nullopt);
+}
+
+void set_global_seed(uint64_t seed) {
+    auto& global = global_seed();
+    auto const lock = std::lock_guard(global.mutex);
+    global.seed = seed;
+    global.next_automatic_stream = 0;
+}
+
+void clear_global_seed() {
+    auto& global = global_seed();
+    auto const lock = std::lock_guard(global.mutex);
+    global.seed.reset();
+    global.next_automatic_stream = 0;
+}
 
+// Not declared in the header. Keeps the symbol exported by versions where
+// rsl::random_unit_quaternion was a non-template function, so binaries built against them still
+// link.
+RSL_EXPORT auto random_unit_quaternion() -> Eigen::Quaterniond;
 auto random_unit_quaternion() -> Eigen::Quaterniond {
-    static constexpr auto pi = 3.1415926535897932385;
-
-    // From "Uniform Random Rotations", Ken Shoemake, Graphics Gems III, pg. 124-132
-    auto const x0 = uniform_real(0., 1.);
-    auto const r1 = std::sqrt(1 - x0);
-    auto const r2 = std::sqrt(x0);
-    auto const t1 = uniform_real(0., 2 * pi);
-    auto const t2 = uniform_real(0., 2 * pi);
-    auto const x = r1 * std::sin(t1);
-    auto const y = r1 * std::cos(t1);
-    auto const z = r2 * std::sin(t2);
-    auto const w = r2 * std::cos(t2);
-    return Eigen::Quaterniond(w, x, y, z).normalized();
+    return random_unit_quaternion<std::mt19937>(rng<std::mt19937>());
 }
 
 }  // namespace rsl
@@ -0,0 +1,87 @@
+#include <rsl/symbol.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace rsl {
+
+namespace {
+using detail::SymbolEntry;
+
+// Open addressing hash table whose slots are only ever written once, from null to an entry. That
+// allows readers to probe it without a lock while a writer holding the mutex inserts into it.
+struct Table {
+    explicit Table(size_t capacity)
+        : mask(capacity - 1),
+          slots(std::make_unique<std::atomic<SymbolEntry const*>[]>(capacity)) {}
+
+    [[nodiscard]] auto find(std::string_view name, size_t hash) const -> SymbolEntry const* {
+        for (auto index = hash & mask;; index = (index + 1) & mask) {
+            auto const* const entry = slots[index].load(std::memory_order_acquire);
+            if (entry == nullptr) return nullptr;
+            if (entry->hash == hash && entry->name == name) return entry;
+        }
+    }
+
+    void insert(SymbolEntry const* entry) {
+        auto index = entry->hash & mask;
+        while (slots[index].load(std::memory_order_relaxed) != nullptr) index = (index + 1) & mask;
+        slots[index].store(entry, std::memory_order_release);
+    }
+
+    size_t mask;
+    std::unique_ptr<std::atomic<SymbolEntry const*>[]> slots;
+};
+
+class InternTable {
+    static constexpr auto initial_capacity = size_t(1024);
+
+    std::atomic<Table const*> table_;
+    std::mutex mutex_;
+    std::deque<SymbolEntry> entries_;            // Stable addresses for the life of the program
+    std::vector<std::unique_ptr<Table>> tables_;  // Old tables may still be in use by readers
+
+   public:
+    InternTable() {
+        tables_.push_back(std::make_unique<Table>(initial_capacity));
+        table_.store(tables_.back().get(), std::memory_order_release);
+    }
+
+    [[nodiscard]] auto intern(std::string_view name) -> SymbolEntry const* {
+        auto const hash = std::hash<std::string_view>()(name);
+        if (auto const* const entry = table_.load(std::memory_order_acquire)->find(name, hash))
+            return entry;
+
+        auto const lock = std::lock_guard(mutex_);
+        auto& table = *tables_.back();
+        if (auto const* const entry = table.find(name, hash)) return entry;
+
+        auto const& entry =
+            entries_.emplace_back(SymbolEntry{hash, uint32_t(entries_.size()), std::string(name)});
+
+        // Keep the load factor at or below one half so probe sequences stay short
+        if (2 * entries_.size() > table.mask + 1) {
+            auto& grown = *tables_.emplace_back(std::make_unique<Table>(2 * (table.mask + 1)));
+            for (auto const& existing : entries_) grown.insert(&existing);
+            table_.store(&grown, std::memory_order_release);
+        } else {
+            table.insert(&entry);
+        }
+        return &entry;
+    }
+};
+
+// Leaked on purpose so symbols stay valid in static destructors and detached threads that run
+// after this table would otherwise have been destroyed
+auto intern_table() -> InternTable& {
+    static auto& instance = *new InternTable();  // NOLINT(cppcoreguidelines-owning-memory)
+    return instance;
+}
+}  // namespace
+
+Symbol::Symbol(std::string_view name) : entry_(intern_table().intern(name)) {}
+
+}  // namespace rsl
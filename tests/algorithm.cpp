@@ -1,11 +1,68 @@
 #include <rsl/algorithm.hpp>
+#include <rsl/random.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <numeric>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+using namespace std::literals;
+
+namespace {
+struct EqualityOnly {
+    int value;
+    [[nodiscard]] auto operator==(EqualityOnly const& other) const { return value == other.value; }
+};
+
+template <typename T, size_t capacity>
+auto random_static_vector(size_t size) {
+    auto static_vector = rsl::StaticVector<T, capacity>();
+    for (size_t i = 0; i < size; ++i) {
+        if constexpr (std::is_floating_point_v<T>)
+            static_vector.push_back(rsl::uniform_real(T(-100), T(100)));
+        else
+            static_vector.push_back(rsl::uniform_int(T(-100), T(100)));
+    }
+    return static_vector;
+}
+
+// Sorts a batch of different inputs per run so branch prediction cannot learn a single input
+template <size_t capacity>
+void benchmark_sort() {
+    constexpr auto batch_size = 100;
+    auto inputs = std::vector<rsl::StaticVector<double, capacity>>();
+    for (int i = 0; i < batch_size; ++i)
+        inputs.push_back(random_static_vector<double, capacity>(capacity));
+
+    BENCHMARK_ADVANCED("rsl::sort, N = " + std::to_string(capacity))
+    (Catch::Benchmark::Chronometer meter) {
+        auto batches = std::vector(size_t(meter.runs()), inputs);
+        meter.measure([&batches](int run) {
+            for (auto& input : batches[size_t(run)]) rsl::sort(input);
+        });
+    };
+    BENCHMARK_ADVANCED("std::sort, N = " + std::to_string(capacity))
+    (Catch::Benchmark::Chronometer meter) {
+        auto batches = std::vector(size_t(meter.runs()), inputs);
+        meter.measure([&batches](int run) {
+            for (auto& input : batches[size_t(run)]) std::sort(input.begin(), input.end());
+        });
+    };
+}
+}  // namespace
+
 TEST_CASE("rsl::contains") {
     SECTION("No items") {
         CHECK_FALSE(rsl::contains(std::array<int, 0>{}, 0));
@@ -30,6 +87,101 @@ TEST_CASE("rsl::contains") {
         CHECK(rsl::contains(values, 1));
         CHECK_FALSE(rsl::contains(values, 0));
     }
+
+    SECTION("Associative containers look up keys") {
+        auto const map = std::map<std::string, int>{{"a", 1}, {"b", 2}};
+        CHECK(rsl::contains(map, "a"));
+        CHECK_FALSE(rsl::contains(map, "c"));
+        CHECK(rsl::contains(map, std::pair<std::string const, int>{"b", 2}));
+        CHECK_FALSE(rsl::contains(map, std::pair<std::string const, int>{"b", 1}));
+
+        auto const unordered_map = std::unordered_map<int, double>{{3, 0.5}};
+        CHECK(rsl::contains(unordered_map, 3));
+        CHECK_FALSE(rsl::contains(unordered_map, 4));
+    }
+
+    SECTION("Contiguous arithmetic ranges") {
+        auto values = std::vector<int64_t>(100);
+        std::iota(values.begin(), values.end(), 0);
+        for (auto const value : values) CHECK(rsl::contains(values, value));
+        CHECK_FALSE(rsl::contains(values, int64_t(100)));
+        CHECK_FALSE(rsl::contains(values, int64_t(-1)));
+        CHECK(rsl::contains(values, 99));  // Converting value type uses std::find
+
+        CHECK(rsl::contains(std::string("hello"), 'o'));
+        CHECK_FALSE(rsl::contains(std::string("hello"), 'z'));
+        CHECK_FALSE(rsl::contains(std::vector{1.F, NAN}, NAN));
+        auto const bytes = rsl::StaticVector<uint8_t, 40>(std::vector<uint8_t>(33, 7));
+        CHECK(rsl::contains(bytes, uint8_t(7)));
+        CHECK_FALSE(rsl::contains(bytes, uint8_t(0)));
+    }
+
+    SECTION("Non-contiguous sequences") {
+        CHECK(rsl::contains(std::deque{1, 2, 3}, 2));
+        CHECK_FALSE(rsl::contains(std::deque{1, 2, 3}, 4));
+    }
+}
+
+TEST_CASE("rsl::contains with rsl::ParallelPolicy") {
+    // Small chunks so the tests use several threads
+    auto const policy = rsl::ParallelPolicy{4, 1'000};
+    auto values = std::vector<int>(100'000);
+    std::iota(values.begin(), values.end(), 0);
+
+    for (auto const value : {0, 999, 25'000, 50'001, 99'999})
+        CHECK(rsl::contains(policy, values, value));
+    CHECK_FALSE(rsl::contains(policy, values, -1));
+    CHECK_FALSE(rsl::contains(policy, values, 100'000));
+    CHECK(rsl::contains(rsl::parallel, values, 7));
+    CHECK_FALSE(rsl::contains(policy, std::vector<int>{}, 0));
+
+    auto strings = std::vector<std::string>(10'000, "a");
+    strings[7'777] = "b";
+    CHECK(rsl::contains(policy, strings, "b"s));
+    CHECK_FALSE(rsl::contains(policy, strings, "c"s));
+    CHECK(rsl::contains(policy, std::set{1, 2, 3}, 2));
+}
+
+namespace {
+// Throws when compared if its id is negative
+struct ThrowingElement {
+    int id;
+
+    friend auto operator==(ThrowingElement const& element, int value) -> bool {
+        if (element.id < 0) throw std::runtime_error("comparison failed");
+        return element.id == value;
+    }
+};
+}  // namespace
+
+TEST_CASE("rsl::contains with rsl::ParallelPolicy joins threads when the calling thread throws") {
+    auto elements = std::vector<ThrowingElement>(4'000);
+    for (size_t i = 0; i < elements.size(); ++i) elements[i].id = int(i);
+    elements.front().id = -1;  // Only in the calling thread's chunk
+    CHECK_THROWS_AS(rsl::contains(rsl::ParallelPolicy{4, 1'000}, elements, 100'000),
+                    std::runtime_error);
+}
+
+TEST_CASE("rsl::contains_sorted") {
+    SECTION("Every size up to 40") {
+        for (int size = 0; size <= 40; ++size) {
+            auto values = std::vector<int>(size_t(size));
+            for (int i = 0; i < size; ++i) values[size_t(i)] = 2 * i;
+            for (int value = -1; value <= 2 * size; ++value) {
+                auto const expected = value >= 0 && value % 2 == 0 && value < 2 * size;
+                CHECK(rsl::contains_sorted(values, value) == expected);
+            }
+        }
+    }
+
+    SECTION("Duplicates, custom order and non-contiguous collections") {
+        CHECK(rsl::contains_sorted(std::array{1, 1, 2, 2, 2, 5}, 2));
+        CHECK_FALSE(rsl::contains_sorted(std::array{1, 1, 2, 2, 2, 5}, 3));
+        CHECK(rsl::contains_sorted(std::vector{5, 3, 1}, 3, std::greater<>()));
+        CHECK_FALSE(rsl::contains_sorted(std::vector{5, 3, 1}, 2, std::greater<>()));
+        CHECK(rsl::contains_sorted(std::deque<std::string>{"a", "b", "c"}, "b"));
+        CHECK_FALSE(rsl::contains_sorted(std::deque<std::string>{"a", "b", "c"}, "d"));
+    }
 }
 
 TEST_CASE("rsl::is_unique") {
@@ -52,4 +204,196 @@ TEST_CASE("rsl::is_unique") {
         CHECK(rsl::is_unique(std::array{-1, 1}));
         CHECK(rsl::is_unique(std::vector<int>{-1, 1}));
     }
+
+    SECTION("Large collections are hashed") {
+        auto values = std::vector<std::string>();
+        for (int i = 0; i < 1'000; ++i) values.push_back(std::to_string(i));
+        CHECK(rsl::is_unique(values));
+        values.push_back("500");
+        CHECK_FALSE(rsl::is_unique(values));
+    }
+
+    SECTION("Large collections without std::hash are sorted") {
+        auto values = std::vector<std::pair<int, int>>();
+        for (int i = 0; i < 100; ++i) values.emplace_back(i % 10, i / 10);
+        CHECK(rsl::is_unique(values));
+        values.emplace_back(3, 3);
+        CHECK_FALSE(rsl::is_unique(values));
+    }
+
+    SECTION("Elements that are only equality comparable") {
+        auto values = std::vector<EqualityOnly>();
+        for (int i = 0; i < 50; ++i) values.push_back({i});
+        CHECK(rsl::is_unique(values));
+        values.push_back({0});
+        CHECK_FALSE(rsl::is_unique(values));
+    }
+
+    SECTION("Non-copyable elements") {
+        auto values = std::vector<std::unique_ptr<int>>();
+        for (int i = 0; i < 40; ++i) values.push_back(std::make_unique<int>(i));
+        CHECK(rsl::is_unique(values));
+        values.push_back(nullptr);
+        values.push_back(nullptr);
+        CHECK_FALSE(rsl::is_unique(values));
+    }
+
+    SECTION("Spans, iterator pairs and proxy references") {
+        auto const values = std::vector{1, 2, 3, 1};
+        CHECK_FALSE(rsl::is_unique(tcb::span(values)));
+        CHECK(rsl::is_unique(tcb::span(values).first(3)));
+        CHECK(rsl::is_unique(values.cbegin() + 1, values.cend()));
+        CHECK(rsl::is_unique(std::vector{true, false}));
+        CHECK_FALSE(rsl::is_unique(std::vector<bool>(40, false)));
+    }
+}
+
+TEST_CASE("rsl::is_unique with rsl::ParallelPolicy") {
+    auto const policy = rsl::ParallelPolicy{4, 1'000};
+    auto values = std::vector<int64_t>(100'000);
+    std::iota(values.begin(), values.end(), 0);
+    CHECK(rsl::is_unique(policy, values));
+    values[90'000] = 3;
+    CHECK_FALSE(rsl::is_unique(policy, values));
+    values[90'000] = 90'000;
+    values[10] = 99'999;
+    CHECK_FALSE(rsl::is_unique(policy, values));
+
+    CHECK(rsl::is_unique(policy, std::vector<int>{}));
+    CHECK_FALSE(rsl::is_unique(policy, std::vector<bool>(5'000)));
+    CHECK_FALSE(rsl::is_unique(rsl::parallel, std::vector{1, 2, 1}));
+}
+
+TEST_CASE("rsl::is_unique_sorted") {
+    CHECK(rsl::is_unique_sorted(std::vector<int>{}));
+    CHECK(rsl::is_unique_sorted(std::vector{1, 2, 3}));
+    CHECK_FALSE(rsl::is_unique_sorted(std::vector{1, 2, 2, 3}));
+    CHECK(rsl::is_unique_sorted(std::vector{3, 2, 1}, std::greater<>()));
+    CHECK_FALSE(rsl::is_unique_sorted(std::vector{3, 3, 1}, std::greater<>()));
+    auto const values = std::array{1, 1, 2, 3};
+    CHECK(rsl::is_unique_sorted(values.cbegin() + 1, values.cend()));
+}
+
+TEMPLATE_TEST_CASE("rsl::sort", "", int, double) {
+    SECTION("Empty") {
+        auto static_vector = rsl::StaticVector<TestType, 8>();
+        rsl::sort(static_vector);
+        CHECK(static_vector.empty());
+    }
+
+    SECTION("Every size up to the capacity") {
+        for (size_t size = 0; size <= 37; ++size) {
+            auto static_vector = random_static_vector<TestType, 37>(size);
+            auto expected = rsl::to_vector(static_vector);
+            std::sort(expected.begin(), expected.end());
+            rsl::sort(static_vector);
+            CHECK(rsl::to_vector(static_vector) == expected);
+        }
+    }
+
+    SECTION("Capacity above the sorting network limit") {
+        auto static_vector = random_static_vector<TestType, 100>(90);
+        rsl::sort(static_vector);
+        CHECK(std::is_sorted(static_vector.begin(), static_vector.end()));
+    }
+
+    SECTION("Custom comparison") {
+        auto static_vector = rsl::StaticVector<TestType, 4>{1, 3, 2, 4};
+        rsl::sort(static_vector, std::greater<>());
+        CHECK(rsl::to_vector(static_vector) == std::vector<TestType>{4, 3, 2, 1});
+    }
+}
+
+TEST_CASE("rsl::sort non-arithmetic") {
+    auto static_vector = rsl::StaticVector<std::string, 5>{"d", "b", "e", "a", "c"};
+    rsl::sort(static_vector);
+    CHECK(rsl::to_vector(static_vector) == std::vector<std::string>{"a", "b", "c", "d", "e"});
+}
+
+TEST_CASE("rsl::is_unique StaticVector") {
+    CHECK(rsl::is_unique(rsl::StaticVector<int, 4>()));
+    CHECK(rsl::is_unique(rsl::StaticVector<int, 4>{3, 1, 2}));
+    CHECK_FALSE(rsl::is_unique(rsl::StaticVector<int, 4>{3, 1, 3}));
+}
+
+TEST_CASE("rsl::nth_element") {
+    auto small = random_static_vector<int, 16>(11);
+    auto large = random_static_vector<int, 100>(77);
+    auto sorted_small = rsl::to_vector(small);
+    auto sorted_large = rsl::to_vector(large);
+    std::sort(sorted_small.begin(), sorted_small.end());
+    std::sort(sorted_large.begin(), sorted_large.end());
+
+    rsl::nth_element(small, 5);
+    rsl::nth_element(large, 40);
+    CHECK(*(small.begin() + 5) == sorted_small[5]);
+    CHECK(*(large.begin() + 40) == sorted_large[40]);
+}
+
+TEST_CASE("rsl::min_max") {
+    CHECK(rsl::min_max(rsl::StaticVector<int, 1>{7}) == std::pair{7, 7});
+    CHECK(rsl::min_max(rsl::StaticVector<double, 8>{3., -1., 4., 1., 5., -9., 2.}) ==
+          std::pair{-9., 5.});
+    CHECK(rsl::min_max(rsl::StaticVector<std::string, 3>{"b", "c", "a"}) ==
+          std::pair<std::string, std::string>{"a", "c"});
+
+    auto const static_vector = random_static_vector<int, 50>(50);
+    auto const [min, max] = std::minmax_element(static_vector.begin(), static_vector.end());
+    CHECK(rsl::min_max(static_vector) == std::pair{*min, *max});
+}
+
+TEST_CASE("rsl::contains benchmark", "[.][benchmark]") {
+    auto values = std::vector<int>(10'000);
+    std::iota(values.begin(), values.end(), 0);
+    BENCHMARK("std::find, 10000 ints") {
+        return std::find(values.cbegin(), values.cend(), -1) != values.cend();
+    };
+    BENCHMARK("rsl::contains, 10000 ints") { return rsl::contains(values, -1); };
+    BENCHMARK("std::binary_search, 10000 ints") {
+        auto found = 0;
+        for (int i = 0; i < 1'000; ++i)
+            found += int(std::binary_search(values.cbegin(), values.cend(), i * 7));
+        return found;
+    };
+    BENCHMARK("rsl::contains_sorted, 10000 ints") {
+        auto found = 0;
+        for (int i = 0; i < 1'000; ++i) found += int(rsl::contains_sorted(values, i * 7));
+        return found;
+    };
+}
+
+TEST_CASE("rsl::is_unique benchmark", "[.][benchmark]") {
+    for (auto const size : {8, 1'000}) {
+        auto values = std::vector<int>(size_t(size));
+        for (auto& value : values) value = rsl::uniform_int(0, 1 << 30);
+        BENCHMARK("Sorting a copy, N = " + std::to_string(size)) {
+            auto copy = values;
+            std::sort(copy.begin(), copy.end());
+            return std::adjacent_find(copy.cbegin(), copy.cend()) == copy.cend();
+        };
+        BENCHMARK("rsl::is_unique, N = " + std::to_string(size)) {
+            return rsl::is_unique(values);
+        };
+    }
+}
+
+TEST_CASE("rsl::ParallelPolicy benchmark", "[.][benchmark]") {
+    auto values = std::vector<int>(1'000'000);
+    std::iota(values.begin(), values.end(), 0);
+    BENCHMARK("rsl::contains, 1000000 ints") { return rsl::contains(values, -1); };
+    BENCHMARK("rsl::contains, rsl::parallel, 1000000 ints") {
+        return rsl::contains(rsl::parallel, values, -1);
+    };
+    BENCHMARK("rsl::is_unique, 1000000 ints") { return rsl::is_unique(values); };
+    BENCHMARK("rsl::is_unique, rsl::parallel, 1000000 ints") {
+        return rsl::is_unique(rsl::parallel, values);
+    };
+}
+
+TEST_CASE("rsl::sort benchmark", "[.][benchmark]") {
+    benchmark_sort<4>();
+    benchmark_sort<8>();
+    benchmark_sort<16>();
+    benchmark_sort<32>();
+    benchmark_sort<64>();
 }
@@ -0,0 +1,92 @@
+#include <rsl/counter_rng.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("rsl::CounterRng") {
+    SECTION("Philox4x32-10 known answers") {
+        using Block = std::array<uint32_t, 4>;
+        CHECK(rsl::CounterRng(0).block(0) == Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+        CHECK(rsl::CounterRng(UINT64_MAX, UINT64_MAX).block(UINT64_MAX) ==
+              Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+        CHECK(rsl::CounterRng(0x299f31d0a4093822, 0x0370734413198a2e).block(0x85a308d3243f6a88) ==
+              Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+    }
+
+    SECTION("Values depend only on seed, stream and index") {
+        auto const rng = rsl::CounterRng(42);
+        CHECK(rng.uniform_real(7, 0., 1.) == rsl::CounterRng(42).uniform_real(7, 0., 1.));
+        CHECK(rng.uniform_real(7, 0., 1.) != rng.uniform_real(8, 0., 1.));
+        CHECK(rng.uniform_real(7, 0., 1.) != rsl::CounterRng(43).uniform_real(7, 0., 1.));
+        CHECK(rng.uniform_real(7, 0., 1.) != rsl::CounterRng(42, 1).uniform_real(7, 0., 1.));
+    }
+
+    SECTION("uniform_real") {
+        auto const rng = rsl::CounterRng(1);
+        auto sum = 0.;
+        for (uint64_t i = 0; i < 10'000; ++i) {
+            auto const value = rng.uniform_real(i, -2.f, 2.f);
+            CHECK(value >= -2.f);
+            CHECK(value < 2.f);
+            sum += double(value);
+        }
+        CHECK(sum / 10'000 == Catch::Approx(0.).margin(0.05));
+    }
+
+    SECTION("uniform_int") {
+        auto const rng = rsl::CounterRng(2);
+        auto counts = std::array<int, 6>();
+        for (uint64_t i = 0; i < 6'000; ++i) {
+            auto const value = rng.uniform_int(i, 1, 6);
+            REQUIRE(value >= 1);
+            REQUIRE(value <= 6);
+            ++counts[size_t(value - 1)];
+        }
+        for (auto const count : counts) CHECK(count > 800);
+        CHECK(rng.uniform_int(0, int64_t(5), int64_t(5)) == 5);
+        CHECK(rng.uniform_int(0, uint64_t(0), UINT64_MAX) !=
+              rng.uniform_int(1, uint64_t(0), UINT64_MAX));
+    }
+
+    SECTION("random_unit_quaternion") {
+        auto const rng = rsl::CounterRng(3);
+        auto w_squared = 0.;
+        for (uint64_t i = 0; i < 10'000; ++i) {
+            auto const quaternion = rng.random_unit_quaternion(i);
+            CHECK(quaternion.norm() == Catch::Approx(1.).epsilon(0).margin(1e-12));
+            w_squared += quaternion.w() * quaternion.w();
+        }
+        CHECK(w_squared / 10'000 == Catch::Approx(0.25).margin(0.01));
+    }
+
+    SECTION("fill_uniform_real matches uniform_real") {
+        auto const rng = rsl::CounterRng(4, 5);
+        auto values = std::vector<double>(21);
+        rng.fill_uniform_real(100, tcb::span(values), -1., 1.);
+        for (size_t i = 0; i < values.size(); ++i)
+            CHECK(values[i] == rng.uniform_real(100 + i, -1., 1.));
+    }
+}
+
+TEST_CASE("rsl::CounterRng benchmark", "[.][benchmark]") {
+    auto const rng = rsl::CounterRng(0);
+    auto values = std::vector<double>(100'000);
+    BENCHMARK("rsl::CounterRng::uniform_real, 100000 numbers") {
+        for (size_t i = 0; i < values.size(); ++i) values[i] = rng.uniform_real(i, 0., 1.);
+        return values.back();
+    };
+    BENCHMARK("rsl::CounterRng::fill_uniform_real, 100000 numbers") {
+        rng.fill_uniform_real(0, tcb::span(values), 0., 1.);
+        return values.back();
+    };
+    BENCHMARK("rsl::fill_uniform_real, 100000 numbers") {
+        rsl::fill_uniform_real(tcb::span(values), 0., 1.);
+        return values.back();
+    };
+}
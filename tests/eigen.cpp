@@ -0,0 +1,99 @@
+#include <rsl/eigen.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace {
+template <typename T, typename = void>
+struct CanMap : std::false_type {};
+template <typename T>
+struct CanMap<T, std::void_t<decltype(rsl::as_eigen(std::declval<T>()))>> : std::true_type {};
+}  // namespace
+
+TEST_CASE("rsl::as_eigen") {
+    SECTION("tcb::span with static extent") {
+        auto values = std::array{1., 2., 3.};
+        auto map = rsl::as_eigen(tcb::span<double, 3>(values));
+        STATIC_CHECK(std::is_same_v<decltype(map), Eigen::Map<Eigen::Vector3d>>);
+        map *= 2.;
+        CHECK(values == std::array{2., 4., 6.});
+    }
+
+    SECTION("tcb::span with dynamic extent") {
+        auto const values = std::array{1., 2., 3., 4.};
+        auto const map = rsl::as_eigen(tcb::span<double const>(values));
+        STATIC_CHECK(std::is_same_v<decltype(map), Eigen::Map<Eigen::VectorXd const> const>);
+        CHECK(map.size() == 4);
+        CHECK(map.data() == values.data());
+        CHECK(map.sum() == 10.);
+    }
+
+    SECTION("std::vector") {
+        auto values = std::vector{1., 2.};
+        rsl::as_eigen(values).setZero();
+        CHECK(values == std::vector{0., 0.});
+
+        auto const& const_values = values;
+        CHECK(rsl::as_eigen(const_values).data() == values.data());
+        STATIC_CHECK(CanMap<std::vector<double> const&>::value);
+        STATIC_CHECK(!CanMap<std::vector<double>>::value);
+    }
+
+    SECTION("rsl::StaticVector") {
+        auto static_vector = rsl::StaticVector<double, 6>{1., 2., 3.};
+        auto map = rsl::as_eigen(static_vector);
+        STATIC_CHECK(decltype(map)::MaxRowsAtCompileTime == 6);
+        CHECK(map.size() == 3);
+        CHECK(reinterpret_cast<std::uintptr_t>(map.data()) % 16 == 0);  // NOLINT
+        map.array() += 1.;
+        CHECK(rsl::to_vector(static_vector) == std::vector{2., 3., 4.});
+
+        auto const const_static_vector = rsl::StaticVector<float, 2>{1.f, 2.f};
+        CHECK(rsl::as_eigen(const_static_vector).sum() == 3.f);
+    }
+
+    SECTION("rsl::StrongType") {
+        using Radians = rsl::StrongType<double, struct RadiansTag>;
+        auto angles = std::vector{Radians(1.), Radians(2.)};
+        auto map = rsl::as_eigen(angles);
+        STATIC_CHECK(std::is_same_v<decltype(map), Eigen::Map<Eigen::VectorXd>>);
+        map *= 2.;
+        CHECK(angles[1].get() == 4.);
+
+        auto const fixed = std::array{Radians(1.), Radians(2.), Radians(3.)};
+        auto const fixed_map = rsl::as_eigen(tcb::span(fixed));
+        STATIC_CHECK(
+            std::is_same_v<decltype(fixed_map), Eigen::Map<Eigen::Vector3d const> const>);
+        CHECK(fixed_map.sum() == 6.);
+
+        auto static_vector = rsl::StaticVector<Radians, 4>{Radians(1.), Radians(2.)};
+        auto static_map = rsl::as_eigen(static_vector);
+        STATIC_CHECK(decltype(static_map)::MaxRowsAtCompileTime == 4);
+        static_map.setZero();
+        CHECK(static_vector.begin()->get() == 0.);
+    }
+
+    SECTION("rclcpp::Parameter") {
+        auto const parameter = rclcpp::Parameter("", std::vector<double>{1., 2., 3.});
+        auto const map = rsl::as_eigen<double>(parameter);
+        CHECK(map.data() == parameter.get_value<std::vector<double>>().data());
+        CHECK(map.isApprox(Eigen::Vector3d(1., 2., 3.)));
+
+        auto const int_parameter = rclcpp::Parameter("", std::vector<int64_t>{4, 5});
+        CHECK(rsl::as_eigen<int64_t>(int_parameter).sum() == 9);
+    }
+}
+
+TEST_CASE("rsl::is_bitwise_copyable") {
+    STATIC_CHECK(rsl::is_bitwise_copyable_v<Eigen::Vector3d>);
+    STATIC_CHECK(rsl::is_bitwise_copyable_v<Eigen::Isometry3d>);
+    STATIC_CHECK(rsl::is_bitwise_copyable_v<Eigen::Quaterniond>);
+    STATIC_CHECK(!rsl::is_bitwise_copyable_v<Eigen::VectorXd>);
+
+    auto pose = rsl::SeqLock<Eigen::Isometry3d>(Eigen::Isometry3d::Identity());
+    auto const expected = Eigen::Isometry3d(Eigen::Translation3d(1., 2., 3.));
+    pose.store(expected);
+    CHECK(pose.load().isApprox(expected));
+}
@@ -1,11 +1,14 @@
 #include <rsl/monad.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <range/v3/all.hpp>
 
 #include <cmath>
+#include <functional>
 #include <string>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -34,6 +37,90 @@ Result<double> multiply(double x, double y) { return x * y; }
 Result<double> divide_3(double x) { return divide(3, x); }
 
 Result<double> multiply_3(double x) { return multiply(3, x); }
+
+// Adds one, counting copies of itself
+struct CountingStage {
+    int* copies;
+
+    explicit CountingStage(int* copies_) : copies(copies_) {}
+    CountingStage(CountingStage const& other) : copies(other.copies) { ++*copies; }
+    CountingStage(CountingStage&&) noexcept = default;
+    CountingStage& operator=(CountingStage const&) = delete;
+    CountingStage& operator=(CountingStage&&) = delete;
+    ~CountingStage() = default;
+
+    auto operator()(int value) const { return std::optional(value + 1); }
+};
+
+// Counts copies and moves, to check that values flow through pipelines without copies
+struct Payload {
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    std::vector<double> points;
+
+    explicit Payload(size_t size) : points(size) {}
+    Payload(Payload const& other) : points(other.points) { ++copies; }
+    Payload(Payload&& other) noexcept : points(std::move(other.points)) { ++moves; }
+    Payload& operator=(Payload const& other) {
+        points = other.points;
+        ++copies;
+        return *this;
+    }
+    Payload& operator=(Payload&& other) noexcept {
+        points = std::move(other.points);
+        ++moves;
+        return *this;
+    }
+    ~Payload() = default;
+
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+
+auto maybe_scale(Payload payload) -> std::optional<Payload> {
+    for (auto& point : payload.points) point *= 2.;
+    return payload;
+}
+
+auto expect_scale(Payload payload) -> Result<Payload> {
+    for (auto& point : payload.points) point *= 2.;
+    return payload;
+}
+
+auto expect_non_empty(Payload payload) -> Result<Payload> {
+    if (payload.points.empty()) return tl::unexpected("empty"s);
+    return payload;
+}
+
+struct CountingError {
+    static inline int copies = 0;
+
+    std::string message;
+
+    explicit CountingError(std::string text) : message(std::move(text)) {}
+    CountingError(CountingError const& other) : message(other.message) { ++copies; }
+    CountingError(CountingError&& other) noexcept = default;
+    CountingError& operator=(CountingError const& other) {
+        message = other.message;
+        ++copies;
+        return *this;
+    }
+    CountingError& operator=(CountingError&& other) noexcept = default;
+    ~CountingError() = default;
+};
+
+auto check_scale(Payload payload) -> tl::expected<Payload, CountingError> {
+    for (auto& point : payload.points) point *= 2.;
+    return payload;
+}
+
+auto check_non_empty(Payload payload) -> tl::expected<Payload, CountingError> {
+    if (payload.points.empty()) return tl::unexpected(CountingError("empty"));
+    return payload;
+}
 }  // namespace
 
 TEST_CASE("rsl::mbind") {
@@ -119,6 +206,22 @@ TEST_CASE("rsl::mbind") {
         CHECK(compose_result == chain_result);
     }
 
+    SECTION("Compose at compile time") {
+        constexpr auto pipeline = rsl::mcompose(maybe_non_zero, maybe_non_zero, maybe_non_zero);
+        STATIC_REQUIRE((std::optional(4) | pipeline) == 4);
+        STATIC_REQUIRE(!(std::optional(0) | pipeline));
+    }
+
+    SECTION("Compose does not copy stages") {
+        auto copies = 0;
+        auto const pipeline = rsl::mcompose(CountingStage{&copies}, CountingStage{&copies},
+                                            CountingStage{&copies}, CountingStage{&copies});
+        copies = 0;
+        CHECK((std::optional(1) | pipeline) == 5);
+        CHECK(pipeline(1) == 5);
+        CHECK(copies == 0);
+    }
+
     SECTION("Pass unexpected value through bind") {
         Result<double> const input = tl::unexpected("foo"s);
         auto const result = rsl::mbind(input, multiply_3);
@@ -161,6 +264,94 @@ TEST_CASE("rsl::mbind") {
     }
 }
 
+TEST_CASE("rsl::mbind moves") {
+    Payload::reset();
+
+    SECTION("Optional chain") {
+        auto const result = std::optional(Payload(3)) | maybe_scale | maybe_scale | maybe_scale;
+        REQUIRE(result.has_value());
+        CHECK(result->points.size() == 3);
+        CHECK(Payload::copies == 0);
+        CHECK(Payload::moves > 0);
+    }
+
+    SECTION("Expected chain") {
+        auto const result = Result<Payload>(Payload(3)) | expect_scale | expect_non_empty;
+        REQUIRE(result.has_value());
+        CHECK(Payload::copies == 0);
+    }
+
+    SECTION("Expected errors are moved") {
+        CountingError::copies = 0;
+        auto const result = tl::expected<Payload, CountingError>(Payload(0)) | check_non_empty |
+                            check_scale | check_scale;
+        REQUIRE(rsl::has_error(result));
+        CHECK(result.error().message == "empty");
+        CHECK(Payload::copies == 0);
+        CHECK(CountingError::copies == 0);
+    }
+
+    SECTION("mcompose") {
+        auto const pipeline = rsl::mcompose(maybe_scale, maybe_scale, maybe_scale);
+        auto const result = std::optional(Payload(3)) | pipeline;
+        REQUIRE(result.has_value());
+        CHECK(Payload::copies == 0);
+    }
+
+    SECTION("Lvalues are passed by const reference") {
+        auto const input = std::optional(Payload(3));
+        Payload::reset();
+        auto const size = input | [](Payload const& payload) -> std::optional<size_t> {
+            return payload.points.size();
+        };
+        CHECK(size == 3);
+        CHECK(Payload::copies == 0);
+        CHECK(Payload::moves == 0);
+    }
+
+    SECTION("Reference-returning stages") {
+        auto payload = Payload(3);
+        Payload::reset();
+        auto const maybe_front =
+            [](Payload& referenced) -> std::optional<std::reference_wrapper<double>> {
+            if (referenced.points.empty()) return std::nullopt;
+            return referenced.points.front();
+        };
+        auto const first_point = std::optional(std::ref(payload)) | maybe_front;
+        REQUIRE(first_point.has_value());
+        first_point->get() = 5.;
+        CHECK(payload.points.front() == 5.);
+        CHECK(Payload::copies == 0);
+        CHECK(Payload::moves == 0);
+
+        auto const size = Result<std::reference_wrapper<Payload const>>(std::cref(payload)) |
+                          [](Payload const& referenced) -> Result<size_t> {
+            return referenced.points.size();
+        };
+        CHECK(size.value() == 3);
+        CHECK(Payload::copies == 0);
+    }
+}
+
+TEST_CASE("rsl::mcompose benchmark", "[.][benchmark]") {
+    // Offsets are read at runtime so neither pipeline folds to a constant
+    auto const offsets = std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    auto const add = [&offsets](size_t index) {
+        return [offset = offsets[index]](int value) {
+            return value < 0 ? std::nullopt : std::optional(value + offset);
+        };
+    };
+    auto const pipeline = rsl::mcompose(add(0), add(1), add(2), add(3), add(4), add(5), add(6),
+                                        add(7), add(8), add(9), add(10), add(11));
+    auto input = 0;
+
+    BENCHMARK("Chained operator|, 12 stages") {
+        return std::optional(++input) | add(0) | add(1) | add(2) | add(3) | add(4) | add(5) |
+               add(6) | add(7) | add(8) | add(9) | add(10) | add(11);
+    };
+    BENCHMARK("rsl::mcompose, 12 stages") { return std::optional(++input) | pipeline; };
+}
+
 TEST_CASE("rsl::has_error") {
     SECTION("Error") {
         // GIVEN expected type containing error
@@ -0,0 +1,127 @@
+#include <rsl/no_alloc_guard.hpp>
+#include <rsl/parameter_validators.hpp>
+#include <rsl/queue.hpp>
+#include <rsl/random.hpp>
+#include <rsl/static_string.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using rclcpp::Parameter;
+
+TEST_CASE("rsl::NoAllocGuard") {
+    SECTION("Type traits") {
+        STATIC_CHECK(!std::is_copy_constructible_v<rsl::NoAllocGuard>);
+        STATIC_CHECK(!std::is_copy_assignable_v<rsl::NoAllocGuard>);
+        STATIC_CHECK(!std::is_move_constructible_v<rsl::NoAllocGuard>);
+        STATIC_CHECK(!std::is_move_assignable_v<rsl::NoAllocGuard>);
+    }
+
+    SECTION("No allocations") {
+        auto const guard = rsl::NoAllocGuard();
+        CHECK(guard.allocation_count() == 0);
+    }
+
+    if (!rsl::NoAllocGuard::enabled) return;
+
+    SECTION("Counts allocations") {
+        auto const guard = rsl::NoAllocGuard();
+        auto const value = std::make_unique<int>(42);
+        auto const vector = std::vector<double>(100);
+        auto const count = guard.allocation_count();
+        CHECK(count == 2);
+    }
+
+    SECTION("Nested guards") {
+        auto const outer = rsl::NoAllocGuard();
+        auto const first = std::make_unique<int>(1);
+        auto inner_count = size_t(0);
+        {
+            auto const inner = rsl::NoAllocGuard();
+            auto const second = std::make_unique<int>(2);
+            inner_count = inner.allocation_count();
+        }
+        auto const outer_count = outer.allocation_count();
+        CHECK(inner_count == 1);
+        CHECK(outer_count == 2);
+    }
+
+    SECTION("Ignores other threads") {
+        auto start = std::atomic<bool>(false);
+        auto thread = std::thread([&start] {
+            while (!start) std::this_thread::yield();
+            auto const value = std::make_unique<int>(42);
+        });
+        auto count = size_t(0);
+        {
+            auto const guard = rsl::NoAllocGuard(rsl::NoAllocGuard::Policy::abort);
+            start = true;
+            thread.join();
+            count = guard.allocation_count();
+        }
+        CHECK(count == 0);
+    }
+}
+
+TEST_CASE("Zero allocation hot paths") {
+    if (!rsl::NoAllocGuard::enabled) return;
+
+    SECTION("rsl::Queue::pop") {
+        auto queue = rsl::Queue<int>();
+        queue.push(42);
+        auto const guard = rsl::NoAllocGuard();
+        auto const first = queue.pop();
+        auto const second = queue.pop();
+        auto const count = guard.allocation_count();
+        CHECK(first.value() == 42);
+        CHECK(!second.has_value());
+        CHECK(count == 0);
+    }
+
+    SECTION("rsl::format_to") {
+        auto const guard = rsl::NoAllocGuard();
+        auto message = rsl::StaticString<64>("Joint ");
+        [[maybe_unused]] auto const fit =
+            rsl::format_to(message, "{} exceeded limit by {:.3f}", 3, 0.25);
+        auto const count = guard.allocation_count();
+        CHECK(message == "Joint 3 exceeded limit by 0.250");
+        CHECK(count == 0);
+    }
+
+    SECTION("rsl/random.hpp") {
+        [[maybe_unused]] auto const& rng = rsl::rng();
+        auto const guard = rsl::NoAllocGuard();
+        for (int i = 0; i < 100; ++i) {
+            [[maybe_unused]] auto const real = rsl::uniform_real(0., 1.);
+            [[maybe_unused]] auto const integer = rsl::uniform_int(0, 10);
+            [[maybe_unused]] auto const quaternion = rsl::random_unit_quaternion();
+        }
+        auto const count = guard.allocation_count();
+        CHECK(count == 0);
+    }
+
+    SECTION("rsl/parameter_validators.hpp") {
+        auto const array_parameter = Parameter("array", std::vector<double>{1., 2., 3.});
+        auto const scalar_parameter = Parameter("scalar", 1.);
+        auto const guard = rsl::NoAllocGuard();
+        auto const results = std::array{
+            rsl::fixed_size<double>(array_parameter, 3).has_value(),
+            rsl::size_gt<double>(array_parameter, 2).has_value(),
+            rsl::not_empty<double>(array_parameter).has_value(),
+            rsl::element_bounds<double>(array_parameter, 0., 4.).has_value(),
+            rsl::lower_element_bounds<double>(array_parameter, 0.).has_value(),
+            rsl::upper_element_bounds<double>(array_parameter, 4.).has_value(),
+            rsl::bounds<double>(scalar_parameter, 0., 2.).has_value(),
+            rsl::lt_eq<double>(scalar_parameter, 2.).has_value(),
+            rsl::gt_eq<double>(scalar_parameter, 0.).has_value(),
+        };
+        auto const count = guard.allocation_count();
+        for (auto const result : results) CHECK(result);
+        CHECK(count == 0);
+    }
+}
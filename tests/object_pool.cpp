@@ -0,0 +1,127 @@
+#include <rsl/object_pool.hpp>
+#include <rsl/queue.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+// Copy constructible only, counting copies
+struct CopyOnly {
+    static inline int copies = 0;
+
+    int value;
+
+    explicit CopyOnly(int initial) : value(initial) {}
+    CopyOnly(CopyOnly const& other) : value(other.value) { ++copies; }
+    CopyOnly(CopyOnly&&) = delete;
+    CopyOnly& operator=(CopyOnly const&) = delete;
+    CopyOnly& operator=(CopyOnly&&) = delete;
+    ~CopyOnly() = default;
+};
+}  // namespace
+
+TEST_CASE("rsl::ObjectPool") {
+    SECTION("Type traits") {
+        STATIC_CHECK(!std::is_copy_constructible_v<rsl::ObjectPool<int>>);
+        STATIC_CHECK(!std::is_move_constructible_v<rsl::ObjectPool<int>>);
+    }
+
+    SECTION("Objects are copies of the prototype") {
+        auto pool = rsl::ObjectPool<std::vector<int>>(2, std::vector<int>{1, 2, 3});
+        CHECK(pool.capacity() == 2);
+        auto const handle = pool.acquire();
+        CHECK(*handle == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Objects are copy constructed once") {
+        CopyOnly::copies = 0;
+        auto pool = rsl::ObjectPool<CopyOnly>(4, CopyOnly(5));
+        CHECK(CopyOnly::copies == 5);  // Prototype and pooled objects
+        CHECK(pool.acquire()->value == 5);
+    }
+
+    SECTION("Objects are reused") {
+        auto pool = rsl::ObjectPool<std::vector<int>>(1);
+        auto handle = pool.acquire();
+        auto const* const address = handle.get();
+        handle->reserve(100);
+        handle.reset();
+
+        auto const reused = pool.acquire();
+        CHECK(reused.get() == address);
+        CHECK(reused->capacity() >= 100);
+    }
+
+    SECTION("Distinct objects until exhausted") {
+        auto pool = rsl::ObjectPool<int>(3);
+        auto handles = std::vector<rsl::ObjectPool<int>::Handle>();
+        for (int i = 0; i < 3; ++i) handles.push_back(pool.acquire());
+        auto const addresses = std::set{handles[0].get(), handles[1].get(), handles[2].get()};
+        CHECK(addresses.size() == 3);
+
+        // Exhausted pools fall back to the heap
+        auto overflow = pool.acquire();
+        REQUIRE(overflow != nullptr);
+        CHECK(addresses.count(overflow.get()) == 0);
+        *overflow = 42;
+        overflow.reset();
+    }
+
+    SECTION("Empty pool") {
+        auto pool = rsl::ObjectPool<int>(0, 7);
+        auto const handle = pool.acquire();
+        CHECK(*handle == 7);
+    }
+
+    SECTION("Release from another thread") {
+        constexpr auto thread_count = size_t(4);
+        constexpr auto item_count = 1'000;
+        auto pool = rsl::ObjectPool<std::vector<int>>(16);
+        auto queue = rsl::Queue<rsl::ObjectPool<std::vector<int>>::Handle>();
+
+        auto producers = std::array<std::thread, thread_count>();
+        for (auto& producer : producers) {
+            producer = std::thread([&] {
+                for (int i = 0; i < item_count; ++i) {
+                    auto handle = pool.acquire();
+                    handle->assign(4, i);
+                    queue.push(std::move(handle));
+                }
+            });
+        }
+
+        // Catch2 assertions are not thread safe, so results are checked after joining
+        auto items_received = std::atomic<size_t>(0);
+        auto items_with_size_4 = std::atomic<size_t>(0);
+        auto consumers = std::array<std::thread, thread_count>();
+        for (auto& consumer : consumers) {
+            consumer = std::thread([&] {
+                for (int i = 0; i < item_count; ++i) {
+                    auto handle = queue.pop(std::chrono::seconds(10));
+                    if (!handle.has_value()) continue;
+                    ++items_received;
+                    if (handle.value()->size() == 4) ++items_with_size_4;
+                }
+            });
+        }
+
+        for (auto& producer : producers) producer.join();
+        for (auto& consumer : consumers) consumer.join();
+        CHECK(items_received == thread_count * item_count);
+        CHECK(items_with_size_4 == thread_count * item_count);
+
+        // Every pooled object made it back
+        auto handles = std::vector<rsl::ObjectPool<std::vector<int>>::Handle>();
+        auto pooled = std::set<std::vector<int> const*>();
+        for (size_t i = 0; i < pool.capacity(); ++i) {
+            handles.push_back(pool.acquire());
+            pooled.insert(handles.back().get());
+        }
+        CHECK(pooled.size() == pool.capacity());
+    }
+}
@@ -347,6 +347,33 @@ TEST_CASE("rsl::one_of") {
     CHECK(result.error() == "Parameter 'test' with the value '0' is not in the set '{1, 2, 3.5}'");
 }
 
+TEST_CASE("Parameter validators with rsl::ParallelPolicy") {
+    auto const policy = rsl::ParallelPolicy{4, 100};
+    auto values = std::vector<int64_t>(10'000);
+    for (size_t i = 0; i < values.size(); ++i) values[i] = int64_t(i);
+    auto const valid = Parameter("test", values);
+
+    CHECK(rsl::unique<int64_t>(policy, valid));
+    CHECK(rsl::element_bounds<int64_t>(policy, valid, 0, 9'999));
+    CHECK(rsl::lower_element_bounds<int64_t>(policy, valid, 0));
+    CHECK(rsl::upper_element_bounds<int64_t>(policy, valid, 9'999));
+    CHECK(rsl::subset_of<int64_t>(policy, Parameter("", std::vector<int64_t>(5'000, 3)), {3}));
+
+    values[9'000] = -7;
+    values[6'000] = 20'000;
+    values[8'000] = 4;
+    auto const invalid = Parameter("test", values);
+    CHECK(!rsl::unique<int64_t>(policy, invalid));
+    CHECK(rsl::element_bounds<int64_t>(policy, invalid, 0, 9'999).error() ==
+          "Value '20000' in parameter 'test' must be within bounds '[0, 9999]'");
+    CHECK(rsl::lower_element_bounds<int64_t>(policy, invalid, 0).error() ==
+          "Value '-7' in parameter 'test' must be above lower bound of '0'");
+    CHECK(rsl::upper_element_bounds<int64_t>(policy, invalid, 9'999).error() ==
+          "Value '20000' in parameter 'test' must be below upper bound of '9999'");
+    CHECK(rsl::subset_of<int64_t>(policy, invalid, {0, 1}).error() ==
+          "Entry '2' in parameter 'test' is not in the set '{0, 1}'");
+}
+
 TEST_CASE("rsl::to_parameter_result_msg") {
     SECTION("Has value") {
         auto const parameter_result = rsl::to_parameter_result_msg({});
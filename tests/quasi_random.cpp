@@ -0,0 +1,157 @@
+#include <rsl/quasi_random.hpp>
+#include <rsl/random.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace {
+// Check that each of the first 2^bits values of a dimension falls in a different interval of width
+// 2^-bits
+template <typename Sequence>
+auto is_stratified(Sequence const& sequence, size_t dimension, int bits) {
+    auto const count = uint64_t(1) << bits;
+    auto intervals = std::set<uint64_t>();
+    for (uint64_t i = 0; i < count; ++i) {
+        intervals.insert(uint64_t(std::ldexp(sequence.value(i, dimension), bits)));
+    }
+    return intervals.size() == count;
+}
+
+// Largest angle between a rotation and its nearest neighbor in the grid
+auto covering_angle(Eigen::Matrix4Xd const& grid, Eigen::Matrix4Xd const& rotations) {
+    auto largest = 0.;
+    for (Eigen::Index i = 0; i < rotations.cols(); ++i) {
+        auto const closest = (grid.transpose() * rotations.col(i)).cwiseAbs().maxCoeff();
+        largest = std::max(largest, 2. * std::acos(std::min(closest, 1.)));
+    }
+    return largest;
+}
+}  // namespace
+
+TEST_CASE("rsl::Halton") {
+    auto const halton = rsl::Halton(3);
+    CHECK(halton.dimensions() == 3);
+
+    SECTION("Known values") {
+        auto const base2 = std::vector{0., 0.5, 0.25, 0.75, 0.125};
+        auto const base3 = std::vector{0., 1. / 3, 2. / 3, 1. / 9, 4. / 9};
+        auto const base5 = std::vector{0., 0.2, 0.4, 0.6, 0.8};
+        for (size_t i = 0; i < base2.size(); ++i) {
+            CHECK(halton.value(i, 0) == Catch::Approx(base2[i]));
+            CHECK(halton.value(i, 1) == Catch::Approx(base3[i]));
+            CHECK(halton.value(i, 2) == Catch::Approx(base5[i]));
+        }
+    }
+
+    SECTION("points matches point") {
+        auto const points = halton.points(10, 20);
+        CHECK(points.rows() == 3);
+        CHECK(points.cols() == 20);
+        for (Eigen::Index i = 0; i < points.cols(); ++i) {
+            CHECK(points.col(i) == halton.point(10 + uint64_t(i)));
+        }
+    }
+
+    SECTION("Stratified in base 2") { CHECK(is_stratified(halton, 0, 10)); }
+}
+
+TEST_CASE("rsl::Sobol") {
+    SECTION("Known values") {
+        auto const sobol = rsl::Sobol(2);
+        auto const first = std::vector{0., 0.5, 0.25, 0.75, 0.125};
+        auto const second = std::vector{0., 0.5, 0.75, 0.25, 0.625};
+        for (size_t i = 0; i < first.size(); ++i) {
+            CHECK(sobol.value(i, 0) == first[i]);
+            CHECK(sobol.value(i, 1) == second[i]);
+        }
+    }
+
+    SECTION("Stratified in every dimension") {
+        auto const sobol = rsl::Sobol(rsl::Sobol::max_dimensions);
+        for (size_t d = 0; d < sobol.dimensions(); ++d) CHECK(is_stratified(sobol, d, 12));
+    }
+
+    SECTION("Two dimensional projections are stratified") {
+        // The first 2^(2k) points of a (0, 2)-sequence have one point in each 2^-k by 2^-k square
+        auto const sobol = rsl::Sobol(2);
+        auto squares = std::set<std::pair<int, int>>();
+        for (uint64_t i = 0; i < 256; ++i) {
+            squares.emplace(int(sobol.value(i, 0) * 16), int(sobol.value(i, 1) * 16));
+        }
+        CHECK(squares.size() == 256);
+    }
+
+    SECTION("Scrambled") {
+        auto const sobol = rsl::Sobol(8, 42);
+        CHECK(sobol.point(0) != Eigen::VectorXd::Zero(8));
+        CHECK(sobol.point(0) == rsl::Sobol(8, 42).point(0));
+        CHECK(sobol.point(0) != rsl::Sobol(8, 43).point(0));
+        for (size_t d = 0; d < sobol.dimensions(); ++d) CHECK(is_stratified(sobol, d, 12));
+
+        auto const points = sobol.points(0, 1000);
+        auto distinct = std::set<double>(points.row(3).begin(), points.row(3).end());
+        CHECK(distinct.size() == 1000);
+        CHECK(points.minCoeff() >= 0.);
+        CHECK(points.maxCoeff() < 1.);
+        CHECK(points.rowwise().mean().minCoeff() == Catch::Approx(0.5).margin(0.01));
+        CHECK(points.rowwise().mean().maxCoeff() == Catch::Approx(0.5).margin(0.01));
+    }
+
+    SECTION("points matches point") {
+        auto const sobol = rsl::Sobol(5, 1);
+        auto const points = sobol.points(100, 20);
+        for (Eigen::Index i = 0; i < points.cols(); ++i) {
+            CHECK(points.col(i) == sobol.point(100 + uint64_t(i)));
+        }
+    }
+}
+
+TEST_CASE("rsl::SO3Grid") {
+    SECTION("Size") {
+        CHECK(rsl::SO3Grid(0).size() == 72);
+        CHECK(rsl::SO3Grid(1).size() == 576);
+        CHECK(rsl::SO3Grid(2).size() == 4608);
+    }
+
+    SECTION("Unit quaternions matching quaternion") {
+        auto const grid = rsl::SO3Grid(1);
+        auto const quaternions = grid.quaternions();
+        CHECK(quaternions.cols() == 576);
+        for (Eigen::Index i = 0; i < quaternions.cols(); ++i) {
+            CHECK(quaternions.col(i).norm() == Catch::Approx(1.));
+            CHECK(quaternions.col(i) == grid.quaternion(size_t(i)).coeffs());
+        }
+    }
+
+    SECTION("Rotations are distinct and evenly spread") {
+        for (size_t level = 0; level < 2; ++level) {
+            auto const quaternions = rsl::SO3Grid(level).quaternions();
+            // q and -q are the same rotation, so compare absolute dot products
+            auto const dots = (quaternions.transpose() * quaternions).cwiseAbs().eval();
+            auto const off_diagonal =
+                dots - Eigen::MatrixXd::Identity(dots.rows(), dots.cols()) * dots.diagonal()(0);
+            CHECK(off_diagonal.maxCoeff() < 1. - 1e-6);
+
+            // A uniform distribution of rotations has E[q q^T] = I / 4
+            auto const second_moment =
+                Eigen::Matrix4d(quaternions * quaternions.transpose() / double(quaternions.cols()));
+            CHECK(second_moment.isApprox(Eigen::Matrix4d::Identity() / 4, 1e-2));
+        }
+    }
+
+    SECTION("Covers rotations better than random samples") {
+        auto const grid = rsl::SO3Grid(1).quaternions();
+        auto const targets = rsl::random_unit_quaternions(2'000);
+        auto const random = rsl::random_unit_quaternions(size_t(grid.cols()));
+        auto const grid_angle = covering_angle(grid, targets);
+        CHECK(grid_angle < 0.5);
+        CHECK(grid_angle < covering_angle(random, targets));
+    }
+}
@@ -1,10 +1,20 @@
 #include <rsl/random.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace {
 auto const* const rng = &rsl::rng({0, 1});
@@ -35,6 +45,143 @@ TEST_CASE("rsl::rng") {
     }
 }
 
+TEMPLATE_TEST_CASE("rsl::rng engine selection", "", std::mt19937, rsl::SplitMix64,
+                   rsl::Xoshiro256PlusPlus, rsl::Pcg64) {
+    SECTION("Repeated calls in thread yield same object") {
+        auto* const engine = &rsl::rng<TestType>();
+        CHECK(engine == &rsl::rng<TestType>());
+        CHECK(engine == &rsl::rng<TestType>({}));
+    }
+
+    SECTION("Seeding in a new thread is deterministic") {
+        auto draw = [] {
+            auto value = typename TestType::result_type();
+            std::thread([&value] { value = rsl::rng<TestType>({4, 5, 6})(); }).join();
+            return value;
+        };
+        CHECK(draw() == draw());
+    }
+
+    SECTION("Distributions accept the engine") {
+        auto& engine = rsl::rng<TestType>();
+        for (int i = 0; i < 100; ++i) {
+            auto const real = rsl::uniform_real(-1., 1., engine);
+            CHECK(real >= -1.);
+            CHECK(real < 1.);
+            auto const integer = rsl::uniform_int(0, 10, engine);
+            CHECK(integer >= 0);
+            CHECK(integer <= 10);
+        }
+    }
+}
+
+TEST_CASE("Random engines") {
+    SECTION("rsl::SplitMix64 matches the reference implementation") {
+        auto engine = rsl::SplitMix64(0);
+        CHECK(engine() == 0xe220a8397b1dcdaf);
+        CHECK(engine() == 0x6e789e6aa1b965f4);
+        CHECK(engine() == 0x06c45d188009454f);
+    }
+
+    SECTION("rsl::Xoshiro256PlusPlus matches the reference implementation") {
+        auto engine = rsl::Xoshiro256PlusPlus(0);
+        CHECK(engine() == 0x53175d61490b23df);
+        CHECK(engine() == 0x61da6f3dc380d507);
+        CHECK(engine() == 0x5c0fdf91ec9a7bfc);
+    }
+
+    SECTION("rsl::Pcg64 matches the reference implementation") {
+        auto engine = rsl::Pcg64(0, 42, 0, 54);
+        CHECK(engine() == 0x86b1da1d72062b68);
+        CHECK(engine() == 0x1304aa46c9853d39);
+        CHECK(engine() == 0xa3670e9e0dd50358);
+    }
+}
+
+TEMPLATE_TEST_CASE("rsl::make_stream_engine", "", std::mt19937, rsl::SplitMix64,
+                   rsl::Xoshiro256PlusPlus, rsl::Pcg64) {
+    auto first = rsl::make_stream_engine<TestType>(42, 3);
+    auto second = rsl::make_stream_engine<TestType>(42, 3);
+    auto other_stream = rsl::make_stream_engine<TestType>(42, 4);
+    auto other_seed = rsl::make_stream_engine<TestType>(43, 3);
+    auto const value = first();
+    CHECK(value == second());
+    CHECK(value != other_stream());
+    CHECK(value != other_seed());
+}
+
+TEST_CASE("rsl::Xoshiro256PlusPlus::jump") {
+    auto engine = rsl::Xoshiro256PlusPlus(0);
+    engine.jump();
+    CHECK(engine() == 0x2107d23f5380538b);
+    CHECK(rsl::make_stream_engine<rsl::Xoshiro256PlusPlus>(0, 1)() == 0x2107d23f5380538b);
+}
+
+TEST_CASE("rsl::make_stream_engine with large stream indices") {
+    // Streams past the jumped ones are derived in O(1), so hashed ids do not take 2^64 jumps
+    auto const last_jumped = rsl::xoshiro_jump_stream_count - 1;
+    auto jumped = rsl::Xoshiro256PlusPlus(7);
+    for (uint64_t i = 0; i < last_jumped; ++i) jumped.jump();
+    CHECK(rsl::make_stream_engine<rsl::Xoshiro256PlusPlus>(7, last_jumped)() == jumped());
+
+    auto const hashed = uint64_t(0x9e3779b97f4a7c15);
+    auto first = rsl::make_stream_engine<rsl::Xoshiro256PlusPlus>(7, hashed);
+    auto second = rsl::make_stream_engine<rsl::Xoshiro256PlusPlus>(7, hashed);
+    auto other = rsl::make_stream_engine<rsl::Xoshiro256PlusPlus>(7, hashed + 1);
+    auto const value = first();
+    CHECK(value == second());
+    CHECK(value != other());
+    CHECK(value != rsl::make_stream_engine<rsl::Xoshiro256PlusPlus>(7, UINT64_MAX)());
+}
+
+TEMPLATE_TEST_CASE("rsl::set_global_seed", "", std::mt19937, rsl::Xoshiro256PlusPlus, rsl::Pcg64) {
+    constexpr auto worker_count = size_t(4);
+    rsl::set_global_seed(1234);
+
+    // Workers start in any order but always draw from the stream of their index
+    // Catch2 assertions are not thread safe, so results are checked after joining
+    auto reseed_throws = std::array<std::atomic<size_t>, 2>{};
+    auto const run = [&reseed_throws](size_t run_index) {
+        auto values = std::vector<typename TestType::result_type>(worker_count);
+        auto workers = std::vector<std::thread>();
+        for (size_t worker = 0; worker < worker_count; ++worker) {
+            workers.emplace_back([worker, run_index, &values, &reseed_throws] {
+                values[worker] = rsl::rng_stream<TestType>(worker)();
+                try {
+                    (void)rsl::rng_stream<TestType>(worker);
+                } catch (std::runtime_error const&) {
+                    ++reseed_throws[run_index];
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        return values;
+    };
+    auto const values = run(0);
+    CHECK(values == run(1));
+    CHECK(reseed_throws[0] == worker_count);
+    CHECK(reseed_throws[1] == worker_count);
+    for (size_t worker = 0; worker < worker_count; ++worker)
+        CHECK(values[worker] == rsl::make_stream_engine<TestType>(1234, worker)());
+
+    // Threads that do not pick a stream get automatic streams, distinct from explicit ones
+    auto automatic = typename TestType::result_type();
+    std::thread([&automatic] { automatic = rsl::rng<TestType>()(); }).join();
+    CHECK(std::find(values.begin(), values.end(), automatic) == values.end());
+
+    // Later tests and threads are seeded from the random device again
+    rsl::clear_global_seed();
+    auto stream_throws = false;
+    std::thread([&stream_throws] {
+        try {
+            (void)rsl::rng_stream<TestType>(0);
+        } catch (std::runtime_error const&) {
+            stream_throws = true;
+        }
+    }).join();
+    CHECK(stream_throws);
+}
+
 TEST_CASE("rsl::uniform_real") {
     constexpr auto lower = -100.;
     constexpr auto upper = 100.;
@@ -55,7 +202,292 @@ TEST_CASE("rsl::uniform_int") {
     }
 }
 
+TEMPLATE_TEST_CASE("rsl::fill_uniform_real", "", float, double) {
+    SECTION("Values are in range") {
+        auto values = std::vector<TestType>(10'000);
+        rsl::fill_uniform_real(tcb::span(values), TestType(-2), TestType(3));
+        auto const [min, max] = std::minmax_element(values.begin(), values.end());
+        CHECK(*min >= TestType(-2));
+        CHECK(*max < TestType(3));
+        CHECK(std::accumulate(values.begin(), values.end(), 0.) / double(values.size()) ==
+              Catch::Approx(0.5).margin(0.1));
+    }
+
+    SECTION("Same seed gives the same values") {
+        auto first = std::array<TestType, 5>();
+        auto second = std::array<TestType, 5>();
+        auto engine = rsl::Xoshiro256PlusPlus(7);
+        rsl::fill_uniform_real(tcb::span(first), TestType(0), TestType(1), engine);
+        engine = rsl::Xoshiro256PlusPlus(7);
+        rsl::fill_uniform_real(tcb::span(second), TestType(0), TestType(1), engine);
+        CHECK(first == second);
+    }
+
+    SECTION("Eigen") {
+        auto matrix = Eigen::Matrix<TestType, 3, Eigen::Dynamic>(3, 100);
+        rsl::fill_uniform_real(matrix, 10, 20);
+        CHECK(matrix.minCoeff() >= 10);
+        CHECK(matrix.maxCoeff() < 20);
+    }
+}
+
+TEMPLATE_TEST_CASE("rsl::fill_uniform_int", "", int8_t, uint16_t, int, int64_t, uint64_t) {
+    SECTION("Values are in range and every value occurs") {
+        auto values = std::vector<TestType>(1'000);
+        rsl::fill_uniform_int(tcb::span(values), TestType(1), TestType(6));
+        for (auto const value : values) {
+            CHECK(value >= 1);
+            CHECK(value <= 6);
+        }
+        for (auto face = TestType(1); face <= 6; ++face)
+            CHECK(std::count(values.begin(), values.end(), face) > 100);
+    }
+
+    SECTION("Single value") {
+        auto values = std::array<TestType, 4>();
+        rsl::fill_uniform_int(tcb::span(values), TestType(5), TestType(5));
+        CHECK(values == std::array<TestType, 4>{5, 5, 5, 5});
+    }
+
+    SECTION("Full range") {
+        auto values = std::array<TestType, 64>();
+        constexpr auto lowest = std::numeric_limits<TestType>::lowest();
+        constexpr auto max = std::numeric_limits<TestType>::max();
+        rsl::fill_uniform_int(tcb::span(values), lowest, max);
+        CHECK(std::adjacent_find(values.begin(), values.end(), std::not_equal_to<>()) !=
+              values.end());
+    }
+}
+
+TEST_CASE("rsl::fill_normal") {
+    SECTION("Odd and even sizes") {
+        for (auto const size : {0, 1, 2, 3}) {
+            auto values = std::vector<double>(size_t(size), -1.);
+            rsl::fill_normal(tcb::span(values), 0., 1.);
+            for (auto const value : values) CHECK(std::isfinite(value));
+        }
+    }
+
+    SECTION("Moments") {
+        auto values = std::vector<double>(100'001);
+        rsl::fill_normal(tcb::span(values), 3., 2.);
+        auto const count = double(values.size());
+        auto const mean = std::accumulate(values.begin(), values.end(), 0.) / count;
+        auto variance = 0.;
+        for (auto const value : values) variance += (value - mean) * (value - mean) / count;
+        CHECK(mean == Catch::Approx(3.).margin(0.05));
+        CHECK(variance == Catch::Approx(4.).margin(0.1));
+    }
+
+    SECTION("Eigen") {
+        auto array = Eigen::ArrayXf(1'000);
+        rsl::fill_normal(array, 0, 1);
+        CHECK(array.isFinite().all());
+        CHECK(std::abs(array.mean()) < 0.2F);
+    }
+}
+
+TEST_CASE("rsl::sample_box") {
+    auto const lower = Eigen::Vector3d(-1., 0., 2.);
+    auto const upper = Eigen::Vector3d(1., 0.5, 2.);
+    auto const samples = rsl::sample_box(lower, upper, 10'000);
+    CHECK(samples.rows() == 3);
+    CHECK(samples.cols() == 10'000);
+    CHECK((samples.array() >= lower.replicate(1, samples.cols()).array()).all());
+    CHECK((samples.array() <= upper.replicate(1, samples.cols()).array()).all());
+    CHECK(samples.row(2).isConstant(2.));
+    CHECK(samples.rowwise().mean().isApprox(Eigen::Vector3d(0., 0.25, 2.), 0.02));
+    CHECK(rsl::sample_box(lower, upper, 0).cols() == 0);
+}
+
+TEST_CASE("rsl::sample_gaussian_around") {
+    auto const center = Eigen::Vector2d(1., -3.);
+    auto const stddev = Eigen::Vector2d(0.5, 2.);
+
+    SECTION("Unclamped") {
+        auto const samples = rsl::sample_gaussian_around(center, stddev, 100'000);
+        auto const mean = samples.rowwise().mean().eval();
+        auto const centered = (samples.colwise() - mean).eval();
+        auto const variance = (centered.array().square().rowwise().sum() / 100'000.).eval();
+        CHECK(mean(0) == Catch::Approx(1.).margin(0.01));
+        CHECK(mean(1) == Catch::Approx(-3.).margin(0.04));
+        CHECK(variance(0) == Catch::Approx(0.25).epsilon(0.02));
+        CHECK(variance(1) == Catch::Approx(4.).epsilon(0.02));
+    }
+
+    SECTION("Clamped") {
+        auto const lower = Eigen::Vector2d(0.8, -10.);
+        auto const upper = Eigen::Vector2d(1.2, -3.);
+        auto const samples = rsl::sample_gaussian_around(center, stddev, lower, upper, 10'000);
+        CHECK((samples.array() >= lower.replicate(1, samples.cols()).array()).all());
+        CHECK((samples.array() <= upper.replicate(1, samples.cols()).array()).all());
+        CHECK((samples.row(1).array() == -3.).count() > 4'000);
+    }
+}
+
 TEST_CASE("rsl::random_unit_quaternion") {
-    for (int i = 0; i < 1'000; ++i)
-        CHECK(rsl::random_unit_quaternion().norm() == Catch::Approx(1.).epsilon(0).margin(1e-6));
+    SECTION("Unit length") {
+        for (int i = 0; i < 1'000; ++i)
+            CHECK(rsl::random_unit_quaternion().norm() ==
+                  Catch::Approx(1.).epsilon(0).margin(1e-6));
+    }
+
+    SECTION("Given engine") {
+        auto first = std::mt19937(42);
+        auto second = std::mt19937(42);
+        CHECK(rsl::random_unit_quaternion(first).coeffs() ==
+              rsl::random_unit_quaternion(second).coeffs());
+    }
+}
+
+TEST_CASE("rsl::random_unit_quaternions") {
+    SECTION("No quaternions") { CHECK(rsl::random_unit_quaternions(0).cols() == 0); }
+
+    SECTION("Unit length and uniformly distributed") {
+        auto const quaternions = rsl::random_unit_quaternions(10'000);
+        REQUIRE(quaternions.cols() == 10'000);
+        CHECK(((quaternions.colwise().norm().array() - 1).abs() < 1e-12).all());
+
+        // Each coefficient of a uniform unit quaternion has zero mean and variance one quarter
+        auto const mean = quaternions.rowwise().mean().eval();
+        auto const variance = quaternions.array().square().rowwise().mean().eval();
+        for (Eigen::Index i = 0; i < 4; ++i) {
+            CHECK(mean(i) == Catch::Approx(0.).margin(0.03));
+            CHECK(variance(i) == Catch::Approx(0.25).margin(0.03));
+        }
+    }
+
+    SECTION("Given engine") {
+        auto first = rsl::Xoshiro256PlusPlus(42);
+        auto second = rsl::Xoshiro256PlusPlus(42);
+        CHECK(rsl::random_unit_quaternions(100, first) ==
+              rsl::random_unit_quaternions(100, second));
+    }
+}
+
+TEST_CASE("rsl::random_rotation_matrices") {
+    auto const rotations = rsl::random_rotation_matrices(100);
+    REQUIRE(rotations.size() == 100);
+    for (auto const& rotation : rotations) {
+        CHECK((rotation * rotation.transpose()).isIdentity(1e-12));
+        CHECK(rotation.determinant() == Catch::Approx(1.));
+    }
+
+    auto first = rsl::Xoshiro256PlusPlus(42);
+    auto second = rsl::Xoshiro256PlusPlus(42);
+    CHECK(rsl::random_rotation_matrices(10, first) == rsl::random_rotation_matrices(10, second));
+}
+
+TEST_CASE("rsl::random_perturbation") {
+    auto const orientation =
+        Eigen::Quaterniond(Eigen::AngleAxisd(1., Eigen::Vector3d(1., 2., 3.).normalized()));
+
+    SECTION("Zero standard deviation") {
+        CHECK(rsl::random_perturbation(orientation, 0.).isApprox(orientation));
+    }
+
+    SECTION("Angle follows a scaled chi distribution") {
+        constexpr auto stddev = 0.1;
+        constexpr auto count = 10'000;
+        auto const perturbations = rsl::random_perturbations(orientation, stddev, count);
+        auto angle_sum = 0.;
+        for (Eigen::Index i = 0; i < perturbations.cols(); ++i) {
+            auto const perturbed =
+                Eigen::Map<Eigen::Quaterniond const>(perturbations.col(i).data());
+            CHECK(perturbed.norm() == Catch::Approx(1.));
+            angle_sum += orientation.angularDistance(perturbed);
+        }
+
+        // Mean of a chi distribution with three degrees of freedom is 2 sqrt(2 / pi)
+        constexpr auto pi = 3.1415926535897932385;
+        CHECK(angle_sum / count == Catch::Approx(stddev * 2 * std::sqrt(2 / pi)).epsilon(0.03));
+    }
+
+    SECTION("Single sample") {
+        auto const perturbed = rsl::random_perturbation(orientation, 0.01);
+        CHECK(perturbed.norm() == Catch::Approx(1.));
+        CHECK(orientation.angularDistance(perturbed) < 0.1);
+    }
+
+    SECTION("Given engine") {
+        auto first = rsl::Xoshiro256PlusPlus(42);
+        auto second = rsl::Xoshiro256PlusPlus(42);
+        CHECK(rsl::random_perturbations(orientation, 0.1, 100, first) ==
+              rsl::random_perturbations(orientation, 0.1, 100, second));
+        CHECK(rsl::random_perturbation(orientation, 0.1, first).coeffs() ==
+              rsl::random_perturbation(orientation, 0.1, second).coeffs());
+    }
+}
+
+namespace {
+template <typename Engine>
+void benchmark_engine(std::string const& name) {
+    constexpr auto batch_size = 1'000;
+    auto engine = Engine();
+    BENCHMARK(name + ", " + std::to_string(batch_size) + " numbers") {
+        auto sum = typename Engine::result_type();
+        for (int i = 0; i < batch_size; ++i) sum += engine();
+        return sum;
+    };
+    BENCHMARK("rsl::uniform_real with " + name + ", " + std::to_string(batch_size) + " numbers") {
+        auto sum = 0.;
+        for (int i = 0; i < batch_size; ++i) sum += rsl::uniform_real(0., 1., rsl::rng<Engine>());
+        return sum;
+    };
+}
+}  // namespace
+
+TEST_CASE("rsl::fill_uniform_real benchmark", "[.][benchmark]") {
+    auto values = std::vector<double>(1'000'000);
+    BENCHMARK("rsl::fill_uniform_real, 1000000 numbers") {
+        rsl::fill_uniform_real(tcb::span(values), 0., 1.);
+        return values.back();
+    };
+    BENCHMARK("rsl::uniform_real, 1000000 numbers") {
+        for (auto& value : values) value = rsl::uniform_real(0., 1.);
+        return values.back();
+    };
+    BENCHMARK("rsl::fill_normal, 1000000 numbers") {
+        rsl::fill_normal(tcb::span(values), 0., 1.);
+        return values.back();
+    };
+    BENCHMARK("std::normal_distribution, 1000000 numbers") {
+        auto distribution = std::normal_distribution(0., 1.);
+        for (auto& value : values) value = distribution(rsl::rng());
+        return values.back();
+    };
+}
+
+TEST_CASE("rsl::sample_box benchmark", "[.][benchmark]") {
+    auto const lower = Eigen::VectorXd::Constant(7, -3.);
+    auto const upper = Eigen::VectorXd::Constant(7, 3.);
+    BENCHMARK("rsl::uniform_real per joint, 100000 configurations") {
+        auto samples = Eigen::MatrixXd(7, 100'000);
+        for (Eigen::Index i = 0; i < samples.cols(); ++i) {
+            for (Eigen::Index j = 0; j < samples.rows(); ++j)
+                samples(j, i) = rsl::uniform_real(lower(j), upper(j));
+        }
+        return samples;
+    };
+    BENCHMARK("rsl::sample_box, 100000 configurations") {
+        return rsl::sample_box(lower, upper, 100'000);
+    };
+}
+
+TEST_CASE("rsl::random_unit_quaternions benchmark", "[.][benchmark]") {
+    BENCHMARK("rsl::random_unit_quaternion, 10000 quaternions") {
+        auto sum = Eigen::Quaterniond(0., 0., 0., 0.);
+        for (int i = 0; i < 10'000; ++i) sum.coeffs() += rsl::random_unit_quaternion().coeffs();
+        return sum;
+    };
+    BENCHMARK("rsl::random_unit_quaternions, 10000 quaternions") {
+        return rsl::random_unit_quaternions(10'000);
+    };
+}
+
+TEST_CASE("Random engine benchmark", "[.][benchmark]") {
+    benchmark_engine<std::mt19937>("std::mt19937");
+    benchmark_engine<rsl::SplitMix64>("rsl::SplitMix64");
+    benchmark_engine<rsl::Xoshiro256PlusPlus>("rsl::Xoshiro256PlusPlus");
+    benchmark_engine<rsl::Pcg64>("rsl::Pcg64");
 }
@@ -0,0 +1,118 @@
+#include <rsl/random.hpp>
+#include <rsl/rolling_stats.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+TEMPLATE_TEST_CASE("rsl::RollingStats", "", float, double) {
+    SECTION("Empty") {
+        auto const stats = rsl::RollingStats<TestType, 4>();
+        CHECK(stats.empty());
+        CHECK(stats.size() == 0);
+        CHECK(stats.mean() == 0);
+        CHECK(stats.variance() == 0);
+    }
+
+    SECTION("Partially filled window") {
+        auto stats = rsl::RollingStats<TestType, 8>();
+        for (auto const sample : {2, 4, 4, 4, 5, 5, 7}) stats.push(TestType(sample));
+        CHECK(stats.size() == 7);
+        CHECK(stats.mean() == Catch::Approx(31. / 7.));
+        CHECK(stats.variance() == Catch::Approx(16. / 7.));
+        CHECK(stats.min() == 2);
+        CHECK(stats.max() == 7);
+        CHECK(stats.percentile(0.) == 2);
+        CHECK(stats.percentile(0.5) == 4);
+        CHECK(stats.percentile(1.) == 7);
+    }
+
+    SECTION("Matches a full recomputation over the window") {
+        constexpr auto window = size_t(16);
+        auto stats = rsl::RollingStats<TestType, window>();
+        auto history = std::vector<TestType>();
+        for (int i = 0; i < 1'000; ++i) {
+            auto const sample = rsl::uniform_real(TestType(-10), TestType(10));
+            stats.push(sample);
+            history.push_back(sample);
+
+            auto const begin = history.end() - std::ptrdiff_t(std::min(history.size(), window));
+            auto const count = double(history.end() - begin);
+            auto const mean = std::accumulate(begin, history.end(), 0.) / count;
+            auto m2 = 0.;
+            for (auto it = begin; it != history.end(); ++it) m2 += (*it - mean) * (*it - mean);
+
+            REQUIRE(stats.size() == size_t(count));
+            CHECK(stats.mean() == Catch::Approx(mean).margin(1e-3));
+            if (count > 1) CHECK(stats.variance() == Catch::Approx(m2 / (count - 1)).margin(1e-2));
+            CHECK(stats.min() == *std::min_element(begin, history.end()));
+            CHECK(stats.max() == *std::max_element(begin, history.end()));
+        }
+    }
+
+    SECTION("Strictly increasing samples longer than the window") {
+        auto stats = rsl::RollingStats<TestType, 3>();
+        for (auto const sample : {1, 2, 3, 4}) stats.push(TestType(sample));
+        CHECK(stats.min() == 2);
+        CHECK(stats.max() == 4);
+        stats.push(5);
+        CHECK(stats.min() == 3);
+        CHECK(stats.max() == 5);
+        for (auto const sample : {6, 7, 8, 9, 10}) stats.push(TestType(sample));
+        CHECK(stats.min() == 8);
+        CHECK(stats.max() == 10);
+    }
+
+    SECTION("Strictly decreasing samples longer than the window") {
+        auto stats = rsl::RollingStats<TestType, 3>();
+        for (auto const sample : {5, 4, 3, 2}) stats.push(TestType(sample));
+        CHECK(stats.min() == 2);
+        CHECK(stats.max() == 4);
+        stats.push(1);
+        CHECK(stats.min() == 1);
+        CHECK(stats.max() == 3);
+        for (auto const sample : {0, -1, -2, -3, -4}) stats.push(TestType(sample));
+        CHECK(stats.min() == -4);
+        CHECK(stats.max() == -2);
+    }
+
+    SECTION("clear()") {
+        auto stats = rsl::RollingStats<TestType, 2>();
+        stats.push(5);
+        stats.push(6);
+        stats.push(7);
+        stats.clear();
+        CHECK(stats.empty());
+        stats.push(1);
+        CHECK(stats.mean() == 1);
+        CHECK(stats.min() == 1);
+        CHECK(stats.max() == 1);
+    }
+}
+
+TEST_CASE("rsl::P2Quantile") {
+    SECTION("Fewer than five samples") {
+        auto median = rsl::P2Quantile<double>(0.5);
+        median.push(3.);
+        median.push(1.);
+        median.push(2.);
+        CHECK(median.count() == 3);
+        CHECK(median.value() == 2.);
+    }
+
+    SECTION("Uniform distribution") {
+        auto median = rsl::P2Quantile<double>(0.5);
+        auto p90 = rsl::P2Quantile<double>(0.9);
+        for (int i = 0; i < 10'000; ++i) {
+            auto const sample = rsl::uniform_real(0., 100.);
+            median.push(sample);
+            p90.push(sample);
+        }
+        CHECK(median.value() == Catch::Approx(50.).margin(3.));
+        CHECK(p90.value() == Catch::Approx(90.).margin(3.));
+    }
+}
@@ -0,0 +1,127 @@
+#include <rsl/sampling.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("rsl::AliasTable") {
+    auto engine = rsl::Xoshiro256PlusPlus(1);
+
+    SECTION("Draws in proportion to weights") {
+        auto const weights = std::vector{1., 0., 3., 4., 2.};
+        auto const table = rsl::AliasTable(tcb::span(weights));
+        CHECK(table.size() == 5);
+
+        constexpr auto draws = 100'000;
+        auto counts = std::array<int, 5>();
+        for (int i = 0; i < draws; ++i) ++counts[table.sample(engine)];
+        CHECK(counts[1] == 0);
+        for (size_t i = 0; i < weights.size(); ++i)
+            CHECK(double(counts[i]) / draws == Catch::Approx(weights[i] / 10.).margin(0.005));
+    }
+
+    SECTION("Single and integer weights") {
+        auto const single = std::array{7};
+        CHECK(rsl::AliasTable(tcb::span(single)).sample(engine) == 0);
+
+        auto const weights = std::vector<int>{0, 0, 5};
+        auto const table = rsl::AliasTable(tcb::span(weights));
+        for (int i = 0; i < 100; ++i) CHECK(table.sample(engine) == 2);
+    }
+
+    SECTION("Fill a span") {
+        auto const weights = std::vector{1., 1., 2.};
+        auto const table = rsl::AliasTable(tcb::span(weights));
+        auto indices = std::vector<uint32_t>(10'000);
+        table.sample(tcb::span(indices), engine);
+        CHECK(std::count(indices.begin(), indices.end(), 2) ==
+              Catch::Approx(5'000).margin(200));
+        CHECK(*std::max_element(indices.begin(), indices.end()) == 2);
+    }
+}
+
+TEST_CASE("rsl::systematic_resample") {
+    auto engine = rsl::Xoshiro256PlusPlus(2);
+
+    SECTION("Counts are the expected counts rounded up or down") {
+        auto const weights = std::vector{0.1, 0., 0.35, 0.05, 0.5, 0.};
+        auto indices = std::vector<size_t>(20);
+        for (int trial = 0; trial < 100; ++trial) {
+            rsl::systematic_resample(tcb::span(weights), tcb::span(indices), engine);
+            CHECK(std::is_sorted(indices.begin(), indices.end()));
+            for (size_t i = 0; i < weights.size(); ++i) {
+                auto const expected = weights[i] * double(indices.size());
+                auto const count = double(std::count(indices.begin(), indices.end(), i));
+                CHECK(count >= std::floor(expected - 1e-9));
+                CHECK(count <= std::ceil(expected + 1e-9));
+            }
+        }
+    }
+
+    SECTION("Unnormalized weights and a different output size") {
+        auto const weights = std::array{2, 6};
+        auto indices = std::array<int, 4>();
+        rsl::systematic_resample(tcb::span(weights), tcb::span(indices), engine);
+        CHECK(indices == std::array{0, 1, 1, 1});
+    }
+}
+
+TEST_CASE("rsl::ReservoirSampler") {
+    auto engine = rsl::Xoshiro256PlusPlus(3);
+
+    SECTION("Keeps everything from short streams") {
+        auto buffer = std::array<int, 5>();
+        auto reservoir = rsl::ReservoirSampler(tcb::span(buffer), engine);
+        CHECK(reservoir.samples().empty());
+        for (int i = 0; i < 3; ++i) reservoir.push(i);
+        CHECK(reservoir.count() == 3);
+        CHECK(std::vector(reservoir.samples().begin(), reservoir.samples().end()) ==
+              std::vector{0, 1, 2});
+    }
+
+    SECTION("Every item is kept with equal probability") {
+        constexpr auto stream_length = 100;
+        constexpr auto trials = 20'000;
+        auto buffer = std::vector<int>(10);
+        auto counts = std::array<int, stream_length>();
+        for (int trial = 0; trial < trials; ++trial) {
+            auto reservoir = rsl::ReservoirSampler(tcb::span(buffer), engine);
+            for (int i = 0; i < stream_length; ++i) reservoir.push(i);
+            REQUIRE(reservoir.samples().size() == 10);
+            for (auto const sample : reservoir.samples()) ++counts[size_t(sample)];
+        }
+        for (auto const count : counts)
+            CHECK(double(count) / trials == Catch::Approx(0.1).margin(0.015));
+    }
+}
+
+TEST_CASE("rsl::AliasTable benchmark", "[.][benchmark]") {
+    auto weights = std::vector<double>(1'000);
+    rsl::fill_uniform_real(tcb::span(weights), 0., 1.);
+    auto cumulative = std::vector<double>(weights.size());
+    std::partial_sum(weights.begin(), weights.end(), cumulative.begin());
+    auto indices = std::vector<size_t>(weights.size());
+
+    BENCHMARK("Binary search over cumulative weights, 1000 draws") {
+        for (auto& index : indices) {
+            auto const point = rsl::uniform_real(0., cumulative.back());
+            index = size_t(std::upper_bound(cumulative.begin(), cumulative.end(), point) -
+                           cumulative.begin());
+        }
+        return indices.back();
+    };
+    BENCHMARK("rsl::AliasTable, construction and 1000 draws") {
+        rsl::AliasTable(tcb::span(weights)).sample(tcb::span(indices));
+        return indices.back();
+    };
+    BENCHMARK("rsl::systematic_resample, 1000 draws") {
+        rsl::systematic_resample(tcb::span(weights), tcb::span(indices));
+        return indices.back();
+    };
+}
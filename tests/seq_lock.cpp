@@ -0,0 +1,127 @@
+#include <rsl/seq_lock.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// Every element equal, so a torn read is detectable
+struct State {
+    std::array<double, 15> values{};
+    char tag{};
+};
+
+auto make_state(int i) {
+    auto state = State();
+    state.values.fill(double(i));
+    state.tag = char(i % 128);
+    return state;
+}
+
+auto is_consistent(State const& state) {
+    for (auto const value : state.values)
+        if (value != state.values.front()) return false;
+    return state.tag == char(int(state.values.front()) % 128);
+}
+
+// Loads the latest value on the benchmark thread while reader_count other threads do the same
+// and a writer stores continuously
+template <typename Load, typename Store>
+void benchmark_readers(std::string const& name, size_t reader_count, Load load, Store store) {
+    auto running = std::atomic<bool>(true);
+    auto threads = std::vector<std::thread>();
+    threads.emplace_back([&] {
+        for (int i = 0; running.load(std::memory_order_relaxed); ++i) store(make_state(i));
+    });
+    for (size_t i = 0; i < reader_count; ++i) {
+        threads.emplace_back([&] {
+            while (running.load(std::memory_order_relaxed)) static_cast<void>(load());
+        });
+    }
+
+    BENCHMARK(name + ", " + std::to_string(reader_count + 1) + " readers") { return load(); };
+
+    running = false;
+    for (auto& thread : threads) thread.join();
+}
+}  // namespace
+
+TEST_CASE("rsl::SeqLock") {
+    SECTION("Type traits") {
+        STATIC_CHECK(rsl::is_bitwise_copyable_v<int>);
+        STATIC_CHECK(rsl::is_bitwise_copyable_v<State>);
+        STATIC_CHECK(!rsl::is_bitwise_copyable_v<std::string>);
+    }
+
+    SECTION("Default constructor") {
+        auto const lock = rsl::SeqLock<int>();
+        CHECK(lock.load() == 0);
+    }
+
+    SECTION("Store and load") {
+        auto lock = rsl::SeqLock<State>(make_state(1));
+        CHECK(lock.load().values.back() == 1.);
+        lock.store(make_state(2));
+        CHECK(lock.load().values.back() == 2.);
+        REQUIRE(lock.try_load().has_value());
+        CHECK(lock.try_load()->tag == 2);
+    }
+
+    SECTION("Size not a multiple of the word size") {
+        auto lock = rsl::SeqLock<std::array<char, 3>>({'a', 'b', 'c'});
+        lock.store({'x', 'y', 'z'});
+        CHECK(lock.load() == std::array{'x', 'y', 'z'});
+    }
+
+    SECTION("Readers never observe a torn value") {
+        auto lock = rsl::SeqLock<State>();
+        auto done = std::atomic<bool>(false);
+        auto writer = std::thread([&] {
+            for (int i = 0; i < 100'000; ++i) lock.store(make_state(i));
+            done = true;
+        });
+
+        auto readers = std::array<std::thread, 3>();
+        auto torn = std::atomic<int>(0);
+        for (auto& reader : readers) {
+            reader = std::thread([&] {
+                while (!done) {
+                    if (!is_consistent(lock.load())) ++torn;
+                    if (auto const value = lock.try_load(); value && !is_consistent(*value)) ++torn;
+                }
+            });
+        }
+
+        writer.join();
+        for (auto& reader : readers) reader.join();
+        CHECK(torn == 0);
+        CHECK(lock.load().values.front() == 99'999.);
+    }
+}
+
+TEST_CASE("rsl::SeqLock benchmark", "[.][benchmark]") {
+    auto lock = rsl::SeqLock<State>();
+    auto mutex = std::mutex();
+    auto state = State();
+    auto const seq_lock_load = [&lock] { return lock.load(); };
+    auto const seq_lock_store = [&lock](State const& value) { lock.store(value); };
+    auto const mutex_load = [&] {
+        auto const guard = std::lock_guard(mutex);
+        return state;
+    };
+    auto const mutex_store = [&](State const& value) {
+        auto const guard = std::lock_guard(mutex);
+        state = value;
+    };
+
+    for (auto const reader_count : {size_t(0), size_t(1), size_t(3), size_t(7)}) {
+        benchmark_readers("rsl::SeqLock", reader_count, seq_lock_load, seq_lock_store);
+        benchmark_readers("std::mutex", reader_count, mutex_load, mutex_store);
+    }
+}
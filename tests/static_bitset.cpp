@@ -0,0 +1,95 @@
+#include <rsl/static_bitset.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+TEST_CASE("rsl::StaticBitSet") {
+    using BitSet = rsl::StaticBitSet<130>;  // Spans three words
+
+    SECTION("Type traits") {
+        STATIC_CHECK(std::is_trivially_copyable_v<BitSet>);
+        STATIC_CHECK(sizeof(BitSet) == 3 * sizeof(uint64_t));
+        STATIC_CHECK(BitSet::max_size() == 130);
+    }
+
+    SECTION("Construction") {
+        SECTION("Default constructor") {
+            auto const bitset = BitSet();
+            CHECK(bitset.empty());
+            CHECK(bitset.size() == 0);
+            CHECK(bitset.begin() == bitset.end());
+        }
+
+        SECTION("Initializer list constructor") {
+            auto const bitset = BitSet{0, 64, 129, 64};
+            CHECK(bitset.size() == 3);
+        }
+
+        SECTION("Collection constructor") {
+            auto const bitset = BitSet(std::vector{3, 1, 2});
+            CHECK(bitset == BitSet{1, 2, 3});
+            CHECK(BitSet(rsl::StaticVector<size_t, 2>{5, 6}) == BitSet{5, 6});
+        }
+    }
+
+    SECTION("contains()") {
+        auto const bitset = BitSet{1, 63, 64, 128};
+        CHECK(bitset.contains(1));
+        CHECK(bitset.contains(63));
+        CHECK(bitset.contains(64));
+        CHECK(bitset.contains(128));
+        CHECK_FALSE(bitset.contains(0));
+        CHECK_FALSE(bitset.contains(129));
+        CHECK_FALSE(bitset.contains(1'000));
+    }
+
+    SECTION("insert() and erase()") {
+        auto bitset = BitSet();
+        bitset.insert(100);
+        CHECK(bitset.contains(100));
+        bitset.erase(100);
+        CHECK_FALSE(bitset.contains(100));
+        bitset.erase(100);
+        CHECK(bitset.empty());
+    }
+
+    SECTION("clear()") {
+        auto bitset = BitSet{1, 2, 3};
+        bitset.clear();
+        CHECK(bitset.empty());
+    }
+
+    SECTION("Iteration") {
+        auto const bitset = BitSet{129, 0, 65, 64, 5};
+        auto const members = std::vector<size_t>(bitset.begin(), bitset.end());
+        CHECK(members == std::vector<size_t>{0, 5, 64, 65, 129});
+    }
+
+    SECTION("Set algebra") {
+        auto const a = BitSet{1, 2, 70, 129};
+        auto const b = BitSet{2, 3, 70};
+        CHECK((a | b) == BitSet{1, 2, 3, 70, 129});
+        CHECK((a & b) == BitSet{2, 70});
+        CHECK((a - b) == BitSet{1, 129});
+        CHECK(a != b);
+
+        CHECK(BitSet{2, 70}.is_subset_of(a));
+        CHECK(BitSet().is_subset_of(a));
+        CHECK(a.is_subset_of(a));
+        CHECK_FALSE(b.is_subset_of(a));
+    }
+
+    SECTION("Empty capacity") {
+        auto const bitset = rsl::StaticBitSet<0>();
+        CHECK(bitset.empty());
+        CHECK(bitset.begin() == bitset.end());
+        CHECK_FALSE(bitset.contains(0));
+    }
+}
+
+TEST_CASE("rsl::to_static_vector") {
+    auto const indices = rsl::to_static_vector(rsl::StaticBitSet<8>{7, 1, 4});
+    CHECK(rsl::to_vector(indices) == std::vector<size_t>{1, 4, 7});
+    CHECK(rsl::to_static_vector(rsl::StaticBitSet<8>()).empty());
+}
@@ -2,6 +2,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstring>
+#include <unordered_set>
+
 using namespace std::literals;
 
 TEST_CASE("rsl::StaticString") {
@@ -36,6 +39,98 @@ TEST_CASE("rsl::StaticString") {
             CHECK(*begin++ == 'l');
             CHECK(*begin++ == 'd');
         }
+
+        SECTION("std::string_view constructor") {
+            auto const static_string = rsl::StaticString<5>("hello"sv);
+            CHECK(std::string_view(static_string) == "hello"sv);
+        }
+
+        SECTION("Character array constructor") {
+            auto const static_string = rsl::StaticString<5>("world");
+            CHECK(std::string_view(static_string) == "world"sv);
+        }
+    }
+
+    SECTION("size()") {
+        CHECK(rsl::StaticString<5>().size() == 0);
+        CHECK(rsl::StaticString<5>("abc").size() == 3);
+        STATIC_CHECK(rsl::StaticString<5>::max_size() == 5);
+    }
+
+    SECTION("empty()") {
+        CHECK(rsl::StaticString<5>().empty());
+        CHECK(!rsl::StaticString<5>("abc").empty());
+    }
+
+    SECTION("data()") {
+        auto const static_string = rsl::StaticString<5>("abc");
+        CHECK(std::string_view(static_string.data(), static_string.size()) == "abc"sv);
+    }
+
+    SECTION("c_str()") {
+        auto static_string = rsl::StaticString<4>("abcd");
+        CHECK(std::strlen(static_string.c_str()) == 4);
+        CHECK(static_string.c_str() == static_string.data());
+
+        static_string.clear();
+        CHECK(std::strlen(static_string.c_str()) == 0);
+
+        static_string.push_back('x');
+        CHECK(std::string_view(static_string.c_str()) == "x"sv);
+
+        static_string.append("yz");
+        CHECK(std::string_view(static_string.c_str()) == "xyz"sv);
+
+        static_string = rsl::StaticString<4>("ab");
+        CHECK(rsl::format_to(static_string, "{}", 7));
+        CHECK(std::string_view(static_string.c_str()) == "ab7"sv);
+    }
+
+    SECTION("operator[]") {
+        auto const static_string = rsl::StaticString<5>("abc");
+        CHECK(static_string[0] == 'a');
+        CHECK(static_string[2] == 'c');
+    }
+
+    SECTION("Mutation") {
+        auto static_string = rsl::StaticString<8>("ab");
+        static_string.push_back('c');
+        static_string += 'd';
+        static_string += "ef"sv;
+        static_string.append("gh");
+        CHECK(static_string == "abcdefgh"sv);
+
+        static_string.clear();
+        CHECK(static_string.empty());
+    }
+
+    SECTION("Comparison") {
+        auto const abc = rsl::StaticString<5>("abc");
+        auto const abd = rsl::StaticString<8>("abd");
+        CHECK(abc == rsl::StaticString<3>("abc"));
+        CHECK(abc != abd);
+        CHECK(abc < abd);
+        CHECK(abc <= abd);
+        CHECK(abd > abc);
+        CHECK(abd >= abc);
+
+        CHECK(abc == "abc");
+        CHECK("abc" == abc);
+        CHECK(abc == "abc"s);
+        CHECK(abc != "abcd"sv);
+        CHECK(abc < "b");
+        CHECK("b" > abc);
+    }
+
+    SECTION("std::hash") {
+        auto const hash = std::hash<rsl::StaticString<8>>();
+        CHECK(hash(rsl::StaticString<8>("abc")) == std::hash<std::string_view>()("abc"sv));
+
+        auto set = std::unordered_set<rsl::StaticString<8>>();
+        set.insert("foo");
+        set.insert("foo");
+        set.insert("bar");
+        CHECK(set.size() == 2);
     }
 
     SECTION("begin()") {
@@ -77,3 +172,21 @@ TEST_CASE("rsl::to_string") {
     CHECK(rsl::to_string(rsl::StaticString<0>()).empty());
     CHECK(rsl::to_string(rsl::StaticString<10>("happy"s)) == "happy"s);
 }
+
+TEST_CASE("rsl::format_to") {
+    SECTION("Fits") {
+        auto static_string = rsl::StaticString<32>("Joint ");
+        CHECK(rsl::format_to(static_string, "{} is at {:.2f}", 3, 1.5));
+        CHECK(static_string == "Joint 3 is at 1.50");
+    }
+
+    SECTION("Truncated") {
+        auto static_string = rsl::StaticString<8>("ab");
+        CHECK(!rsl::format_to(static_string, "{}", 1234567890));
+        CHECK(static_string == "ab123456");
+    }
+
+    SECTION("fmt::formatter") {
+        CHECK(fmt::format("[{:>5}]", rsl::StaticString<8>("abc")) == "[  abc]");
+    }
+}
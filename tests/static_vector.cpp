@@ -70,6 +70,24 @@ TEMPLATE_TEST_CASE("rsl::StaticVector", "", int, float) {
         }
     }
 
+    SECTION("size()") {
+        CHECK(rsl::StaticVector<TestType, 5>().size() == 0);
+        CHECK(rsl::StaticVector<TestType, 5>{1, 2, 3}.size() == 3);
+    }
+
+    SECTION("empty()") {
+        CHECK(rsl::StaticVector<TestType, 5>().empty());
+        CHECK(!rsl::StaticVector<TestType, 5>{1}.empty());
+    }
+
+    SECTION("push_back()") {
+        auto static_vector = rsl::StaticVector<TestType, 3>();
+        static_vector.push_back(7);
+        static_vector.push_back(8);
+        static_vector.push_back(9);
+        CHECK(rsl::to_vector(static_vector) == std::vector<TestType>{7, 8, 9});
+    }
+
     SECTION("User defined conversions") {
         SECTION("tcb::span<T>()") {
             auto static_vector = rsl::StaticVector<TestType, 5>{11, 12, 13, 14, 15};
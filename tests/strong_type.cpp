@@ -1,7 +1,12 @@
+#include <rsl/static_vector.hpp>
 #include <rsl/strong_type.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <string>
+#include <vector>
+
 TEST_CASE("rsl::StrongType") {
     using StrongInt = rsl::StrongType<int, struct StrongIntTag>;  // For testing constexpr support
     using StrongString =
@@ -12,6 +17,12 @@ TEST_CASE("rsl::StrongType") {
         STATIC_CHECK(std::is_copy_assignable_v<StrongInt>);
         STATIC_CHECK(std::is_nothrow_move_constructible_v<StrongInt>);
         STATIC_CHECK(std::is_nothrow_move_assignable_v<StrongInt>);
+        STATIC_CHECK(std::is_default_constructible_v<StrongInt>);
+        STATIC_CHECK(StrongInt().get() == 0);
+        STATIC_CHECK(sizeof(StrongInt) == sizeof(int));
+        STATIC_CHECK(alignof(StrongInt) == alignof(int));
+        STATIC_CHECK(std::is_trivially_copyable_v<StrongInt>);
+        STATIC_CHECK(sizeof(StrongString) == sizeof(std::string));
     }
 
     SECTION("Construction") {
@@ -32,3 +43,107 @@ TEST_CASE("rsl::StrongType") {
         CHECK(strong_int.get() == 100);
     }
 }
+
+namespace {
+struct LengthTag {};
+template <typename Lhs, typename Rhs, typename = void>
+struct CanAdd : std::false_type {};
+template <typename Lhs, typename Rhs>
+struct CanAdd<Lhs, Rhs, std::void_t<decltype(std::declval<Lhs>() + std::declval<Rhs>())>>
+    : std::true_type {};
+}  // namespace
+
+template <>
+struct rsl::strong_type_traits<LengthTag> {
+    static constexpr bool arithmetic = true;
+};
+
+TEST_CASE("rsl::StrongType arithmetic") {
+    using Length = rsl::StrongType<double, LengthTag>;
+    using StrongInt = rsl::StrongType<int, struct StrongIntTag>;
+
+    SECTION("Opt-in") {
+        STATIC_CHECK(CanAdd<Length, Length>::value);
+        STATIC_CHECK(!CanAdd<StrongInt, StrongInt>::value);
+        STATIC_CHECK(!CanAdd<Length, double>::value);
+    }
+
+    SECTION("Operators") {
+        STATIC_CHECK((Length(1.) + Length(2.)).get() == 3.);
+        STATIC_CHECK((Length(1.) - Length(2.)).get() == -1.);
+        STATIC_CHECK((-Length(1.)).get() == -1.);
+        STATIC_CHECK((Length(1.5) * 2.).get() == 3.);
+        STATIC_CHECK((2. * Length(1.5)).get() == 3.);
+        STATIC_CHECK((Length(3.) / 2.).get() == 1.5);
+        STATIC_CHECK(Length(3.) / Length(2.) == 1.5);
+        STATIC_CHECK(Length(1.) == Length(1.));
+        STATIC_CHECK(Length(1.) != Length(2.));
+        STATIC_CHECK(Length(1.) < Length(2.));
+        STATIC_CHECK(Length(1.) <= Length(1.));
+        STATIC_CHECK(Length(2.) > Length(1.));
+        STATIC_CHECK(Length(1.) >= Length(1.));
+    }
+
+    SECTION("Compound assignment") {
+        auto length = Length(1.);
+        length += Length(2.);
+        CHECK(length.get() == 3.);
+        length -= Length(1.);
+        CHECK(length.get() == 2.);
+        length *= 3.;
+        CHECK(length.get() == 6.);
+        length /= 4.;
+        CHECK(length.get() == 1.5);
+    }
+}
+
+TEST_CASE("rsl::unwrap_span") {
+    using Radians = rsl::StrongType<double, struct RadiansTag>;
+
+    SECTION("std::vector") {
+        auto angles = std::vector{Radians(1.), Radians(2.)};
+        auto const values = rsl::unwrap_span(angles);
+        STATIC_CHECK(std::is_same_v<decltype(values), tcb::span<double> const>);
+        CHECK(static_cast<void const*>(values.data()) == angles.data());
+        values[1] = 3.;
+        CHECK(angles[1].get() == 3.);
+
+        auto const& const_angles = angles;
+        STATIC_CHECK(
+            std::is_same_v<decltype(rsl::unwrap_span(const_angles)), tcb::span<double const>>);
+        CHECK(rsl::unwrap_span(const_angles).size() == 2);
+    }
+
+    SECTION("Static extent") {
+        auto angles = std::array{Radians(1.), Radians(2.), Radians(3.)};
+        auto const values = rsl::unwrap_span(tcb::span(angles));
+        STATIC_CHECK(std::is_same_v<decltype(values), tcb::span<double, 3> const>);
+        CHECK(values[2] == 3.);
+    }
+
+    SECTION("rsl::StaticVector") {
+        auto angles = rsl::StaticVector<Radians, 4>{Radians(1.), Radians(2.)};
+        auto const values = rsl::unwrap_span(angles);
+        CHECK(values.size() == 2);
+        CHECK(values[0] == 1.);
+    }
+}
+
+TEST_CASE("rsl::wrap_span") {
+    using Radians = rsl::StrongType<double, struct RadiansTag>;
+
+    auto values = std::vector{1., 2.};
+    auto const angles = rsl::wrap_span<Radians>(values);
+    STATIC_CHECK(std::is_same_v<decltype(angles), tcb::span<Radians> const>);
+    CHECK(static_cast<void const*>(angles.data()) == values.data());
+    angles[0] = Radians(4.);
+    CHECK(values[0] == 4.);
+
+    auto const& const_values = values;
+    STATIC_CHECK(std::is_same_v<decltype(rsl::wrap_span<Radians>(const_values)),
+                                tcb::span<Radians const>>);
+
+    auto const fixed = std::array{1., 2., 3.};
+    STATIC_CHECK(std::is_same_v<decltype(rsl::wrap_span<Radians>(tcb::span(fixed))),
+                                tcb::span<Radians const, 3>>);
+}
@@ -0,0 +1,80 @@
+#include <rsl/symbol.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+using namespace std::literals;
+
+TEST_CASE("rsl::Symbol") {
+    SECTION("Type traits") {
+        STATIC_CHECK(std::is_trivially_copyable_v<rsl::Symbol>);
+        STATIC_CHECK(sizeof(rsl::Symbol) == sizeof(void*));
+    }
+
+    SECTION("Default constructor") {
+        auto const symbol = rsl::Symbol();
+        CHECK(symbol.view().empty());
+        CHECK(symbol == rsl::Symbol(""));
+    }
+
+    SECTION("view()") {
+        auto const name = "shoulder_pan_joint"s;
+        auto const symbol = rsl::Symbol(name);
+        CHECK(symbol.view() == name);
+        CHECK(symbol.view().data() != name.data());
+    }
+
+    SECTION("Comparison") {
+        auto const a = rsl::Symbol("a");
+        auto const b = rsl::Symbol("b");
+        CHECK(a == rsl::Symbol("a"sv));
+        CHECK(a != b);
+        CHECK(a.id() == rsl::Symbol("a").id());
+        CHECK(a.id() != b.id());
+        CHECK((a < b) == (a.id() < b.id()));
+        CHECK((a < b) != (b < a));
+    }
+
+    SECTION("std::hash") {
+        auto const symbol = rsl::Symbol("elbow_joint");
+        CHECK(std::hash<rsl::Symbol>()(symbol) == std::hash<std::string_view>()("elbow_joint"sv));
+
+        auto const set = std::unordered_set{rsl::Symbol("x"), rsl::Symbol("y"), rsl::Symbol("x")};
+        CHECK(set.size() == 2);
+    }
+
+    SECTION("Many symbols") {
+        // Enough to force the table to grow several times
+        constexpr auto count = 10'000;
+        auto ids = std::unordered_set<uint32_t>();
+        for (int i = 0; i < count; ++i) ids.insert(rsl::Symbol("many_" + std::to_string(i)).id());
+        CHECK(ids.size() == count);
+        for (int i = 0; i < count; ++i) {
+            auto const name = "many_" + std::to_string(i);
+            CHECK(rsl::Symbol(name).view() == name);
+        }
+    }
+
+    SECTION("Concurrently") {
+        constexpr auto thread_count = size_t(8);
+        constexpr auto name_count = 1'000;
+
+        auto results = std::array<std::vector<rsl::Symbol>, thread_count>();
+        auto threads = std::array<std::thread, thread_count>();
+        for (size_t i = 0; i < thread_count; ++i) {
+            threads[i] = std::thread([&result = results[i]] {
+                for (int j = 0; j < name_count; ++j)
+                    result.emplace_back("concurrent_" + std::to_string(j));
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        for (auto const& result : results) CHECK(result == results.front());
+        for (int j = 0; j < name_count; ++j)
+            CHECK(results.front()[size_t(j)].view() == "concurrent_" + std::to_string(j));
+    }
+}
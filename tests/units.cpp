@@ -0,0 +1,103 @@
+#include <rsl/units.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+#include <vector>
+
+using namespace rsl::units;
+
+namespace {
+template <typename Lhs, typename Rhs, typename = void>
+struct CanAdd : std::false_type {};
+template <typename Lhs, typename Rhs>
+struct CanAdd<Lhs, Rhs, std::void_t<decltype(std::declval<Lhs>() + std::declval<Rhs>())>>
+    : std::true_type {};
+}  // namespace
+
+TEST_CASE("rsl::Quantity") {
+    SECTION("Layout") {
+        STATIC_CHECK(sizeof(Meters) == sizeof(double));
+        STATIC_CHECK(alignof(Meters) == alignof(double));
+        STATIC_CHECK(std::is_trivially_copyable_v<Meters>);
+        STATIC_CHECK(std::is_standard_layout_v<Meters>);
+    }
+
+    SECTION("Dimension checking") {
+        STATIC_CHECK(CanAdd<Meters, Meters>::value);
+        STATIC_CHECK(!CanAdd<Meters, Seconds>::value);
+        STATIC_CHECK(!CanAdd<Meters, Millimeters>::value);
+        STATIC_CHECK(!CanAdd<Radians, Degrees>::value);
+    }
+
+    SECTION("Products and quotients") {
+        STATIC_CHECK(std::is_same_v<decltype(Meters(1.) / Seconds(1.)), MetersPerSecond>);
+        STATIC_CHECK(
+            std::is_same_v<decltype(MetersPerSecond(1.) / Seconds(1.)), MetersPerSecondSquared>);
+        STATIC_CHECK(std::is_same_v<decltype(MetersPerSecond(1.) * Seconds(1.)), Meters>);
+        STATIC_CHECK(std::is_same_v<decltype(Radians(1.) / Seconds(1.)), RadiansPerSecond>);
+        STATIC_CHECK((Meters(3.) / Seconds(2.)).get() == 1.5);
+        STATIC_CHECK((MetersPerSecond(2.) * Seconds(3.)).get() == 6.);
+        STATIC_CHECK(Meters(3.) / Meters(2.) == 1.5);
+        STATIC_CHECK(Millimeters(500.) / Meters(1.) == 0.5);
+        STATIC_CHECK(Seconds(2.) * (Meters(1.) / Seconds(1.)) == Meters(2.));
+    }
+
+    SECTION("Irrational scales are simplified") {
+        STATIC_CHECK(std::is_same_v<decltype(Degrees(1.) * Seconds(1.) / Seconds(1.)), Degrees>);
+        STATIC_CHECK(std::is_same_v<decltype(Seconds(1.) * Degrees(1.) / Seconds(1.)), Degrees>);
+        STATIC_CHECK(std::is_same_v<decltype(Degrees(1.) / Seconds(1.) * Seconds(1.)), Degrees>);
+        STATIC_CHECK(std::is_same_v<decltype(Meters(1.) * Degrees(1.) / Degrees(1.)), Meters>);
+        STATIC_CHECK(std::is_same_v<decltype(Meters(1.) / Degrees(1.) * Degrees(1.)), Meters>);
+        CHECK((Degrees(90.) * Seconds(2.) / Seconds(2.)).get() == Catch::Approx(90.));
+    }
+
+    SECTION("unit_cast") {
+        STATIC_CHECK(rsl::unit_cast<Meters>(Millimeters(250.)) == Meters(0.25));
+        STATIC_CHECK(rsl::unit_cast<Millimeters>(Meters(0.25)) == Millimeters(250.));
+        STATIC_CHECK(rsl::unit_cast<Seconds>(Milliseconds(1500.)) == Seconds(1.5));
+        STATIC_CHECK(rsl::unit_cast<Meters>(Meters(2.)) == Meters(2.));
+        CHECK(rsl::unit_cast<Radians>(Degrees(180.)).get() == Catch::Approx(3.14159265358979));
+        CHECK(rsl::unit_cast<Degrees>(Radians(3.14159265358979)).get() == Catch::Approx(180.));
+        CHECK(rsl::unit_cast<RadiansPerSecond>(Degrees(90.) / Milliseconds(500.)).get() ==
+              Catch::Approx(3.14159265358979));
+    }
+}
+
+TEST_CASE("rsl::Quantity with integral values") {
+    using IntMeters = rsl::Quantity<int, rsl::Unit<Length>>;
+    using IntMillimeters = rsl::Quantity<int, rsl::Unit<Length, std::milli>>;
+
+    STATIC_CHECK(rsl::unit_cast<IntMeters>(IntMillimeters(2500)) == IntMeters(2));
+    STATIC_CHECK(rsl::unit_cast<IntMeters>(IntMillimeters(-2500)) == IntMeters(-2));
+    STATIC_CHECK(rsl::unit_cast<IntMillimeters>(IntMeters(3)) == IntMillimeters(3000));
+    STATIC_CHECK(IntMillimeters(2500) / IntMeters(1) == 2);
+    STATIC_CHECK(IntMeters(3) / IntMillimeters(1) == 3000);
+}
+
+TEST_CASE("rsl::Quantity benchmark", "[.][benchmark]") {
+    auto const raw = [] {
+        auto values = std::vector<double>(10'000);
+        std::iota(values.begin(), values.end(), 0.);
+        return values;
+    }();
+    auto const quantities = [&] {
+        auto values = std::vector<Millimeters>();
+        values.reserve(raw.size());
+        for (auto const value : raw) values.push_back(Millimeters(value));
+        return values;
+    }();
+
+    BENCHMARK("double, sum of millimeters in meters / seconds") {
+        auto sum = 0.;
+        for (auto const value : raw) sum += value * 0.001 / 2.;
+        return sum;
+    };
+    BENCHMARK("rsl::Quantity, sum of millimeters in meters / seconds") {
+        auto sum = MetersPerSecond(0.);
+        for (auto const& value : quantities) sum += rsl::unit_cast<Meters>(value) / Seconds(2.);
+        return sum.get();
+    };
+}